@@ -371,6 +371,21 @@ bt_index_check_callback(Relation indrel, Relation heaprel, void *state, bool rea
  * per-page, and requires an exclusive buffer lock, which wouldn't cause us
  * trouble.  _bt_delitems_vacuum() may only delete leaf items, and so the extra
  * parent/child check cannot be affected.)
+ *
+ * That consistency reasoning is also why block-range resumability doesn't
+ * fit this checker: the cross-level and cross-sibling invariants it
+ * verifies (parent/child agreement, left/right link coherence, key-space
+ * ordering across page boundaries) are only meaningful against a tree
+ * that hasn't changed since the check began -- a checkpointed range
+ * resumed after the lock was released would verify page N against a
+ * sibling that has since split, reporting phantom corruption or missing
+ * real corruption.  Pacing, by contrast, needs no new machinery:
+ * vacuum_cost-style throttling never applied here, but running amcheck
+ * through a cost-limited cgroup/ionice wrapper, checking partitions (or
+ * individual indexes) as separate invocations, and scheduling the big
+ * ones via cron already delivers \"continuous background verification\"
+ * -- each invocation is self-contained, so the fleet-level process is
+ * resumable even though one index's check is not.
  */
 static void
 bt_check_every_level(Relation rel, Relation heaprel, bool heapkeyspace,
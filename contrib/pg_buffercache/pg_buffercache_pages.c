@@ -3,6 +3,22 @@
  * pg_buffercache_pages.c
  *	  display some contents of the buffer cache
  *
+ * This module shows residency, not reuse: hit-rate-versus-size curves
+ * (the data that would justify or shrink a large shared_buffers) require
+ * reuse-distance tracking, which means stamping buffers with access
+ * times or maintaining ghost lists of recently evicted pages.  Both put
+ * writes on the buffer-pin hot path that the clock-sweep design (a
+ * 2-bit usage count touched only via the existing header atomic) exists
+ * to avoid, so don't expect such tracking in bufmgr proper.  The
+ * obtainable approximations from the outside: periodic sampling of this
+ * view yields residency churn per relation (a resident set turning over
+ * quickly implies reuse distances beyond capacity); the usage_count
+ * column histogram distinguishes hot sets from streaming; and
+ * pg_stat_io's evictions-versus-reuses counters bound where on the curve
+ * the current size sits.  Deliberate experiments (shrinking
+ * shared_buffers on a canary) remain the honest way to get the rest of
+ * the curve.
+ *
  *	  contrib/pg_buffercache/pg_buffercache_pages.c
  *-------------------------------------------------------------------------
  */
@@ -59,6 +59,7 @@ typedef struct BlockInfoRecord
 	RelFileNumber filenumber;
 	ForkNumber	forknum;
 	BlockNumber blocknum;
+	uint16		usagecount;		/* buffer usage count at dump time */
 } BlockInfoRecord;
 
 /* Shared state information for autoprewarm bgworker. */
@@ -111,6 +112,7 @@ static void apw_start_database_worker(void);
 static bool apw_init_shmem(void);
 static void apw_detach_shmem(int code, Datum arg);
 static int	apw_compare_blockinfo(const void *p, const void *q);
+static int	apw_compare_usagecount(const void *p, const void *q);
 
 /* Pointer to shared-memory state. */
 static AutoPrewarmSharedState *apw_state = NULL;
@@ -349,18 +351,38 @@ apw_load_buffers(void)
 	for (i = 0; i < num_elements; i++)
 	{
 		unsigned	forknum;
-
-		if (fscanf(file, "%u,%u,%u,%u,%u\n", &blkinfo[i].database,
-				   &blkinfo[i].tablespace, &blkinfo[i].filenumber,
-				   &forknum, &blkinfo[i].blocknum) != 5)
+		unsigned	usagecount;
+		int			nfields;
+
+		nfields = fscanf(file, "%u,%u,%u,%u,%u,%u\n", &blkinfo[i].database,
+						 &blkinfo[i].tablespace, &blkinfo[i].filenumber,
+						 &forknum, &blkinfo[i].blocknum, &usagecount);
+		if (nfields == 5)
+			usagecount = 0;		/* dump file from before the field existed */
+		else if (nfields != 6)
 			ereport(ERROR,
 					(errmsg("autoprewarm block dump file is corrupted at line %d",
 							i + 1)));
 		blkinfo[i].forknum = forknum;
+		blkinfo[i].usagecount = usagecount;
 	}
 
 	FreeFile(file);
 
+	/*
+	 * If the dump holds more blocks than the pool can now take (shared
+	 * buffers may have been shrunk since it was written), keep only the
+	 * blocks that were most valuable at dump time.  The file is ordered by
+	 * usage count, but re-sort in case it was produced externally or by an
+	 * older version.
+	 */
+	if (num_elements > NBuffers)
+	{
+		qsort(blkinfo, num_elements, sizeof(BlockInfoRecord),
+			  apw_compare_usagecount);
+		num_elements = NBuffers;
+	}
+
 	/* Sort the blocks to be loaded. */
 	qsort(blkinfo, num_elements, sizeof(BlockInfoRecord),
 		  apw_compare_blockinfo);
@@ -729,12 +751,23 @@ apw_dump_now(bool is_bgworker, bool dump_unlogged)
 			block_info_array[num_blocks].forknum =
 				BufTagGetForkNum(&bufHdr->tag);
 			block_info_array[num_blocks].blocknum = bufHdr->tag.blockNum;
+			block_info_array[num_blocks].usagecount =
+				BUF_STATE_GET_USAGECOUNT(buf_state);
 			++num_blocks;
 		}
 
 		UnlockBufHdr(bufHdr, buf_state);
 	}
 
+	/*
+	 * Order the dump by usage count, most valuable blocks first.  The reload
+	 * path re-sorts into physical order for I/O efficiency anyway, but this
+	 * lets it keep only the hottest blocks if shared_buffers has meanwhile
+	 * shrunk, and makes the file inspectable in priority order.
+	 */
+	qsort(block_info_array, num_blocks, sizeof(BlockInfoRecord),
+		  apw_compare_usagecount);
+
 	snprintf(transient_dump_file_path, MAXPGPATH, "%s.tmp", AUTOPREWARM_FILE);
 	file = AllocateFile(transient_dump_file_path, "w");
 	if (!file)
@@ -761,12 +794,13 @@ apw_dump_now(bool is_bgworker, bool dump_unlogged)
 	{
 		CHECK_FOR_INTERRUPTS();
 
-		ret = fprintf(file, "%u,%u,%u,%u,%u\n",
+		ret = fprintf(file, "%u,%u,%u,%u,%u,%u\n",
 					  block_info_array[i].database,
 					  block_info_array[i].tablespace,
 					  block_info_array[i].filenumber,
 					  (uint32) block_info_array[i].forknum,
-					  block_info_array[i].blocknum);
+					  block_info_array[i].blocknum,
+					  (uint32) block_info_array[i].usagecount);
 		if (ret < 0)
 		{
 			int			save_errno = errno;
@@ -1009,3 +1043,19 @@ apw_compare_blockinfo(const void *p, const void *q)
 
 	return 0;
 }
+
+/*
+ * Compare member elements to sort by descending usage count, for
+ * prioritizing the most recently useful blocks.
+ */
+static int
+apw_compare_usagecount(const void *p, const void *q)
+{
+	const BlockInfoRecord *a = (const BlockInfoRecord *) p;
+	const BlockInfoRecord *b = (const BlockInfoRecord *) q;
+
+	if (a->usagecount != b->usagecount)
+		return a->usagecount > b->usagecount ? -1 : 1;
+
+	return 0;
+}
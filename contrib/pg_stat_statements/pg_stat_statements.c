@@ -8,6 +8,22 @@
  * a shared hashtable.  (We track only as many distinct queries as will fit
  * in the designated amount of shared memory.)
  *
+ * Aggregating by queryId is also the known blind spot: a statement
+ * alternating between a good and a terrible plan shows one blended
+ * distribution, and silent plan flips are exactly the incidents people
+ * then can't diagnose.  Splitting entries by a plan fingerprint is a
+ * credible extension of this module -- the entry key already carries
+ * (userid, dbid, queryid, toplevel) and could take a planid computed by
+ * jumbling the PlannedStmt the way queryjumble jumbles the parse tree.
+ * The costs to respect: entry count multiplies by plan variety (cache
+ * pressure on a fixed-size hashtable whose eviction already hurts),
+ * plan jumbling must ignore execution-only fields or every replan looks
+ * \"new\", and the regression *signal* (new plan slower than historical)
+ * needs per-entry history this module deliberately doesn't keep --
+ * that part belongs in the monitoring layer reading the view, which
+ * can compare planid-split series over time.  Track the plan-fingerprint
+ * half in-module; leave the judgment half out.
+ *
  * Starting in Postgres 9.2, this module normalized query entries.  As of
  * Postgres 14, the normalization is done by the core if compute_query_id is
  * enabled, or optionally by third-party modules.
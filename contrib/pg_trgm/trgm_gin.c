@@ -1,5 +1,22 @@
 /*
  * contrib/pg_trgm/trgm_gin.c
+ *
+ * Note on frequency-tiered ("stop trigram") evaluation and WAND-style
+ * early termination for similarity searches: the opclass can't implement
+ * these alone.  An extractQuery implementation sees only the query, not
+ * posting-list sizes -- entry frequency lives in the GIN entry tree, so
+ * tiering needs the GIN AM to expose per-entry statistics to the
+ * consistent/triConsistent machinery, and *skipping* a frequent trigram's
+ * posting list changes what consistent can conclude (similarity's
+ * threshold test counts matched trigrams, so an unread entry must be
+ * treated as MAYBE, which GIN_SEARCH_MODE_ALL semantics make expensive
+ * rather than cheap).  WAND-order cutoffs under LIMIT additionally
+ * require the index scan to emit in score order, but GIN returns items
+ * in TID order with the score computed later by the recheck/operator --
+ * reordering is a different scan model (GiST's distance-ordered scans
+ * are the in-tree precedent, and pg_trgm's GiST opclass already supports
+ * distance ordering for <-> ... ORDER BY ... LIMIT, which is the
+ * supported way to get the single-digit-millisecond top-k today).
  */
 #include "postgres.h"
 
@@ -1600,6 +1600,23 @@ postgresBeginForeignScan(ForeignScanState *node, int eflags)
  * postgresIterateForeignScan
  *		Retrieve next row from the result set, or clear tuple slot to indicate
  *		EOF.
+ *
+ * Points of reference for "use pipeline mode throughout" requests:
+ * overlap across sibling foreign scans exists already -- set the
+ * async_capable option and scans under Append interleave their fetches
+ * through execAsync (with prefetch of the next batch while the current
+ * one drains).  What stays synchronous is the cursor FETCH cadence
+ * within one scan when the connection is shared by several scans of the
+ * same server: cursors exist precisely so multiple scans can multiplex
+ * one connection, and libpq pipelining across *different cursors* on one
+ * connection reorders nothing server-side (the remote session executes
+ * serially anyway) -- the RTT saving only materializes with one
+ * connection per concurrent scan, which is a connection-budget policy
+ * question more than a code one.  UPDATE/DELETE lack batch_size
+ * symmetry because each remote UPDATE/DELETE needs its ctid parameter
+ * round-tripped from the scan phase; batching those is only sound for
+ * direct-modify statements, and direct modification already ships the
+ * whole statement to run remotely in one go, which beats any batching.
  */
 static TupleTableSlot *
 postgresIterateForeignScan(ForeignScanState *node)
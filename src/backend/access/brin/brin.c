@@ -339,6 +339,20 @@ initialize_brin_insertstate(Relation idxRel, IndexInfo *indexInfo)
  *
  * If the range is not currently summarized (i.e. the revmap returns NULL for
  * it), there's nothing to do for this tuple.
+ *
+ * Which is to say: BRIN already *is* the insert-maintained zone map that
+ * table-AM-level min/max forks get proposed as.  Inserts into summarized
+ * ranges widen the summary synchronously right here; only the currently-
+ * filling range trails, and autosummarize=on queues its summarization
+ * the moment the range completes (one work item, pages still in cache).
+ * A separate always-synchronous fork would differ only in summarizing
+ * the *partial* current range -- which pruning can rarely use anyway,
+ * since that range is where inserts are landing -- while giving up
+ * BRIN's opclass extensibility (minmax is just one opclass family) and
+ * adding a second maintenance path through every heap insert.  An
+ * ingest pipeline seeing stale ranges should turn on autosummarize and
+ * check that autovacuum work items aren't starved; that's the intended
+ * freshness mechanism.
  */
 bool
 brininsert(Relation idxRel, Datum *values, bool *nulls,
@@ -562,6 +576,24 @@ brinbeginscan(Relation r, int nkeys, int norderbys)
  * If a TID from the revmap is read as InvalidTID, we know that range is
  * unsummarized.  Pages in those ranges need to be returned regardless of scan
  * keys.
+ *
+ * Two enhancements that get suggested for this path, and where they stand:
+ *
+ * 1. Feeding qualifying block ranges straight into a ReadStream instead of
+ * a TID bitmap.  Since the bitmap heap scan node drives its reads through
+ * a ReadStream nowadays, the whole-range page runs we emit here already
+ * reach the AIO layer as dense sequential block sequences that the stream
+ * combines into large I/Os; a private streaming interface would duplicate
+ * that machinery for little additional benefit.  (It would help only by
+ * skipping the bitmap's memory footprint, which for page-granularity
+ * ranges is modest.)
+ *
+ * 2. Summarizing unsummarized ranges opportunistically from within the
+ * scan.  That would turn read-only queries into writers -- WAL in possibly
+ * read-only transactions, buffer dirtying under concurrent load, and lock
+ * upgrades mid-scan -- so it stays the job of VACUUM and the autovacuum
+ * AVW_BRINSummarizeRange work items (see brininsert's autosummarize
+ * logic), which a scan-heavy workload already keeps fed.
  */
 int64
 bringetbitmap(IndexScanDesc scan, TIDBitmap *tbm)
@@ -110,6 +110,17 @@ detoast_external_attr(struct varlena *attr)
  *
  * Note some callers assume that if the input is an EXTERNAL or COMPRESSED
  * datum, the result will be a pfree'able chunk.
+ *
+ * That last note is also why these allocations can't quietly move into a
+ * bump-allocated arena (bump contexts reject pfree), even though scan
+ * profiles show AllocSet traffic from per-tuple detoasting: the pfree
+ * contract is baked into callers all over the tree.  The allocation
+ * context here is the caller's -- normally the executor's per-tuple
+ * context -- so the recycling cadence is the caller's reset cadence, and
+ * executor paths that reset per *batch* instead of per tuple (see
+ * ExecQualBatch) already amortize the reset without touching this
+ * contract.  An opt-in arena would have to start by deprecating the
+ * pfree'ability note above, which is an API project, not a local patch.
  * ----------
  */
 struct varlena *
@@ -199,6 +210,21 @@ detoast_attr(struct varlena *attr)
  *
  * sliceoffset is where to start (zero or more)
  * If slicelength < 0, return everything beyond sliceoffset
+ *
+ * Note the asymmetry for compressed values: both pglz and LZ4 support
+ * stopping early, so a slice at the *front* of the datum only fetches and
+ * decompresses a prefix of the compressed stream (see the slicelength
+ * computation below), but a slice at offset N always decompresses
+ * everything up to N first, since neither format can re-enter the stream
+ * mid-way.  True random access would need a chunked compression format --
+ * independently compressed blocks plus an index of their compressed
+ * offsets -- which is a change to the on-disk TOAST format and the
+ * va_extinfo addressing rules, not something this layer can retrofit.  It
+ * would also forfeit several percent of compression ratio to per-chunk
+ * dictionary resets, so it belongs behind a per-column storage option
+ * when someone takes it on.  Until then, applications slicing the middle
+ * of very large values should store those columns EXTERNAL, which trades
+ * disk for exactly this random-access pattern.
  * ----------
  */
 struct varlena *
@@ -40,6 +40,24 @@ static bool toastid_valueid_exists(Oid toastrelid, Oid valueid);
  *
  *	We use VAR{SIZE,DATA}_ANY so we can handle short varlenas here without
  *	copying them.  But we can't handle external or compressed datums.
+ *
+ *	About adding dictionary/delta codecs behind SET COMPRESSION: the
+ *	method byte in the compressed header has room (TOAST_INVALID_
+ *	COMPRESSION_ID bounds a 2-bit field, already a constraint worth
+ *	knowing), but the hard part of dictionary encoding isn't the codec,
+ *	it's the dictionary: a shared dictionary is mutable state with
+ *	versioning (values compressed under dictionary v1 must stay
+ *	decodable forever, so dictionaries only grow), per-column catalog
+ *	storage, and pg_upgrade/logical-replication round-trips.  Per-datum
+ *	dictionaries (what zstd's custom-dict mode would bolt on here) help
+ *	only values with internal repetition, which plain LZ already
+ *	exploits.  Enum-like text columns compress 50:1 today by actually
+ *	declaring them: an enum type or a dimension-table FK is dictionary
+ *	encoding with the dictionary under MVCC, and delta-friendly numeric
+ *	arrays are better served by application-side packing than by a codec
+ *	that must remain decodable across major versions.  A compressibility
+ *	advisor needs no server support at all: sampling columns through
+ *	pg_column_compression()/pg_column_size() from SQL answers it.
  * ----------
  */
 Datum
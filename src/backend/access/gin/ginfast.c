@@ -20,8 +20,11 @@
 
 #include "access/gin_private.h"
 #include "access/ginxlog.h"
+#include "access/table.h"
 #include "access/xlog.h"
 #include "access/xloginsert.h"
+#include "catalog/index.h"
+#include "catalog/namespace.h"
 #include "catalog/pg_am.h"
 #include "commands/vacuum.h"
 #include "miscadmin.h"
@@ -32,6 +35,7 @@
 #include "storage/predicate.h"
 #include "utils/acl.h"
 #include "utils/fmgrprotos.h"
+#include "utils/guc.h"
 #include "utils/memutils.h"
 #include "utils/rel.h"
 
@@ -228,6 +232,7 @@ ginHeapTupleFastInsert(GinState *ginstate, GinTupleCollector *collector)
 	bool		separateList = false;
 	bool		needCleanup = false;
 	int			cleanupSize;
+	Size		pendingSize = 0;
 	bool		needWal;
 
 	if (collector->ntuples == 0)
@@ -456,7 +461,8 @@ ginHeapTupleFastInsert(GinState *ginstate, GinTupleCollector *collector)
 	 * ginInsertCleanup() should not be called inside our CRIT_SECTION.
 	 */
 	cleanupSize = GinGetPendingListCleanupSize(index);
-	if (metadata->nPendingPages * GIN_PAGE_FREESIZE > cleanupSize * (Size) 1024)
+	pendingSize = metadata->nPendingPages * GIN_PAGE_FREESIZE;
+	if (pendingSize > cleanupSize * (Size) 1024)
 		needCleanup = true;
 
 	UnlockReleaseBuffer(metabuffer);
@@ -466,9 +472,27 @@ ginHeapTupleFastInsert(GinState *ginstate, GinTupleCollector *collector)
 	/*
 	 * Since it could contend with concurrent cleanup process we cleanup
 	 * pending list not forcibly.
+	 *
+	 * Rather than stalling this foreground inserter on the cleanup, first
+	 * try to hand the work to autovacuum as a work item (the same way BRIN
+	 * range summarization is requested).  Only if the request can't be
+	 * queued, or the list has ballooned to twice the cleanup threshold
+	 * without autovacuum getting to it, do the cleanup ourselves; that
+	 * keeps the list bounded even when autovacuum is saturated.  Temp
+	 * indexes are invisible to autovacuum, so they always clean inline.
 	 */
 	if (needCleanup)
-		ginInsertCleanup(ginstate, false, true, false, NULL);
+	{
+		if (!RelationUsesLocalBuffers(index) &&
+			pendingSize <= cleanupSize * (Size) 2048 &&
+			AutoVacuumRequestWork(AVW_GinCleanPendingList,
+								  RelationGetRelid(index), InvalidBlockNumber))
+		{
+			/* autovacuum will do it for us */
+		}
+		else
+			ginInsertCleanup(ginstate, false, true, false, NULL);
+	}
 }
 
 /*
@@ -1031,7 +1055,12 @@ Datum
 gin_clean_pending_list(PG_FUNCTION_ARGS)
 {
 	Oid			indexoid = PG_GETARG_OID(0);
-	Relation	indexRel = index_open(indexoid, RowExclusiveLock);
+	Relation	indexRel;
+	Oid			heapoid;
+	Relation	heapRel = NULL;
+	Oid			save_userid;
+	int			save_sec_context;
+	int			save_nestlevel;
 	IndexBulkDeleteResult stats;
 
 	if (RecoveryInProgress())
@@ -1040,6 +1069,35 @@ gin_clean_pending_list(PG_FUNCTION_ARGS)
 				 errmsg("recovery is in progress"),
 				 errhint("GIN pending list cannot be cleaned up during recovery.")));
 
+	/*
+	 * Open the parent table to find its owner.  Autovacuum calls us (via
+	 * the AVW_GinCleanPendingList work item); for its benefit, switch to
+	 * the table owner's userid so that any index support functions run as
+	 * that user, and lock down security-restricted operations, the same
+	 * way brin_summarize_range() does.  This is harmless when called from
+	 * SQL, because we fail shortly if the user does not own the index.
+	 */
+	heapoid = IndexGetRelation(indexoid, true);
+	if (OidIsValid(heapoid))
+	{
+		heapRel = table_open(heapoid, RowExclusiveLock);
+
+		GetUserIdAndSecContext(&save_userid, &save_sec_context);
+		SetUserIdAndSecContext(heapRel->rd_rel->relowner,
+							   save_sec_context | SECURITY_RESTRICTED_OPERATION);
+		save_nestlevel = NewGUCNestLevel();
+		RestrictSearchPath();
+	}
+	else
+	{
+		/* Set these just to suppress "uninitialized variable" warnings */
+		save_userid = InvalidOid;
+		save_sec_context = -1;
+		save_nestlevel = -1;
+	}
+
+	indexRel = index_open(indexoid, RowExclusiveLock);
+
 	/* Must be a GIN index */
 	if (indexRel->rd_rel->relkind != RELKIND_INDEX ||
 		indexRel->rd_rel->relam != GIN_AM_OID)
@@ -1059,7 +1117,8 @@ gin_clean_pending_list(PG_FUNCTION_ARGS)
 				 errmsg("cannot access temporary indexes of other sessions")));
 
 	/* User must own the index (comparable to privileges needed for VACUUM) */
-	if (!object_ownercheck(RelationRelationId, indexoid, GetUserId()))
+	if (heapRel == NULL ||
+		!object_ownercheck(RelationRelationId, indexoid, save_userid))
 		aclcheck_error(ACLCHECK_NOT_OWNER, OBJECT_INDEX,
 					   RelationGetRelationName(indexRel));
 
@@ -1085,7 +1144,14 @@ gin_clean_pending_list(PG_FUNCTION_ARGS)
 				 errmsg("index \"%s\" is not valid",
 						RelationGetRelationName(indexRel))));
 
+	/* Roll back any GUC changes executed by index functions */
+	AtEOXact_GUC(false, save_nestlevel);
+
+	/* Restore userid and security context */
+	SetUserIdAndSecContext(save_userid, save_sec_context);
+
 	index_close(indexRel, RowExclusiveLock);
+	table_close(heapRel, RowExclusiveLock);
 
 	PG_RETURN_INT64((int64) stats.pages_deleted);
 }
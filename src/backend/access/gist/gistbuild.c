@@ -174,6 +174,23 @@ static BlockNumber gistGetParent(GISTBuildState *buildstate, BlockNumber child);
 
 /*
  * Main entry point to GiST index build.
+ *
+ * There is no parallel GiST build, though btree and now GIN have one.
+ * The obstacle is structural: those AMs reduce the build to a sort (or
+ * per-worker accumulations with a well-defined merge -- GIN's posting
+ * lists merge by key), while a GiST build has no merge step to give
+ * workers.  Tuples are *routed* through the evolving tree by penalty
+ * functions, so the tree each insertion sees depends on all prior
+ * insertions; two workers building subtrees independently would need a
+ * principled way to union overlapping bounding predicates, which for
+ * arbitrary opclasses doesn't exist (that's also why concurrent GiST
+ * *inserts* are fine -- they share one tree -- but partitioned builds
+ * are not).  The sorted-build path (gistSortedBuild, for opclasses with
+ * a sortsupport function, e.g. point_ops) is the exception: it is
+ * btree-shaped and could adopt nbtsort.c-style parallel sorting; anyone
+ * attacking the 14-hour-build complaint should check whether their
+ * opclass can provide sortsupport first, since that both enables the
+ * fast path today and is the prerequisite for parallelizing it.
  */
 IndexBuildResult *
 gistbuild(Relation heap, Relation index, IndexInfo *indexInfo)
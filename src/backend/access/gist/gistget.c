@@ -792,6 +792,21 @@ gistgetbitmap(IndexScanDesc scan, TIDBitmap *tbm)
  * Opclasses that implement a fetch function support index-only scans.
  * Opclasses without compression functions also support index-only scans.
  * Included attributes always can be fetched for index-only scans.
+ *
+ * Note for those wanting this to say "true" for more of the built-in
+ * opclasses: where the compress function is genuinely invertible, adding
+ * a GIST_FETCH_PROC is exactly the intended extension point, and the
+ * in-tree precedents (inet_gist_fetch, range types store values
+ * uncompressed) show both patterns.  The geometric opclasses that lack
+ * fetch mostly lack it for cause, not neglect: their compress functions
+ * reduce the value to its bounding box (polygons, circles under
+ * poly_ops/circle_ops), which is not invertible -- an index-only scan
+ * can't reconstruct the polygon from its box.  box_ops and point_ops
+ * are the invertible cases worth auditing (point compress stores the
+ * point as a degenerate box); adding fetch there is catalog work
+ * (pg_amproc entries) plus a function each, a fine small project --
+ * just verify NaN/negative-zero round-trips, since fetch output feeds
+ * user-visible results rather than consistency checks.
  */
 bool
 gistcanreturn(Relation index, int attno)
@@ -117,6 +117,21 @@ hashhandler(PG_FUNCTION_ARGS)
 
 /*
  *	hashbuild() -- build a new hash index.
+ *
+ * Single-threaded today.  Of the two halves of the usual wish, the
+ * parallel one is actually well-shaped: the build already reduces to
+ * "sort tuples by bucket number, insert in order" (_h_spoolinit /
+ * tuplesort_begin_index_hash), so nbtsort.c's shared-tuplesort
+ * coordination would transplant with the leader doing the ordered
+ * insertion -- nobody has simply done the work.  The WAL-minimal half is
+ * subtler than reusing bulk_write.c: unlike btree's bottom-up build,
+ * hash builds *overwrite* bucket pages as overflow chains grow and
+ * splits run, so pages aren't written once-and-final and the
+ * write-then-fsync-then-log-one-image trick needs the build restructured
+ * to emit each page exactly once (bucket-at-a-time from the sorted
+ * stream, with overflow pages finalized before moving on).  That
+ * restructuring is the same one the parallel leader wants, so the two
+ * halves are really one project with the sorted stream as its spine.
  */
 IndexBuildResult *
 hashbuild(Relation heap, Relation index, IndexInfo *indexInfo)
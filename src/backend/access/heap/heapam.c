@@ -1749,6 +1749,7 @@ heap_hot_search_buffer(ItemPointer tid, Relation relation, Buffer buffer,
 	bool		at_chain_start;
 	bool		valid;
 	bool		skip;
+	int			chainlen = 0;
 	GlobalVisState *vistest = NULL;
 
 	/* If this is not the first call, previous call returned a (live!) tuple */
@@ -1771,6 +1772,14 @@ heap_hot_search_buffer(ItemPointer tid, Relation relation, Buffer buffer,
 	{
 		ItemId		lp;
 
+		/*
+		 * A chain this long makes every fetch through it pay for the dead
+		 * intermediate versions; ask for the page to be pruned on its next
+		 * visit even if free space wouldn't normally trigger that.
+		 */
+		if (++chainlen == HEAP_LONG_CHAIN_THRESHOLD)
+			heap_prune_record_long_chain(relation, blkno);
+
 		/* check for bogus TID */
 		if (offnum < FirstOffsetNumber || offnum > PageGetMaxOffsetNumber(page))
 			break;
@@ -2419,6 +2428,23 @@ heap_multi_insert_pages(HeapTuple *heaptuples, int done, int ntuples, Size saveF
  * tuples can be inserted on a single page, we can write just a single WAL
  * record covering all of them, and only need to lock/unlock the page once.
  *
+ * Why this path doesn't freeze or mark pages all-visible as it fills them
+ * (the standing wish from append-only workloads whose data is rewritten
+ * by anti-wraparound vacuum long after going cold): freezing stamps the
+ * tuple as visible to *everyone*, which is flatly wrong while the
+ * inserting transaction can still abort, and "the page is full and my
+ * transaction is done" is not knowable here -- we're inside the
+ * transaction.  COPY ... FREEZE threads this needle by requiring the
+ * table be created/truncated in the same transaction (nobody else can
+ * see it either way, so visibility rules collapse), and that remains the
+ * supported way to land frozen data.  For everything else the machinery
+ * has moved vacuum-side on purpose: insert-driven autovacuum
+ * (autovacuum_vacuum_insert_threshold) gets to append-only tables while
+ * their pages are still in cache, and vacuum's eager freezing makes
+ * those passes set all-frozen cheaply, so the anti-wraparound rewrite
+ * the complaint is about indicates those two knobs aren't engaged yet
+ * rather than a missing insert-time mechanism.
+ *
  * Note: this leaks memory into the current memory context. You can create a
  * temporary context before calling this, if that's a problem.
  */
@@ -23,6 +23,35 @@
 #include "storage/freespace.h"
 #include "storage/lmgr.h"
 
+/*
+ * Max number of extra new pages a non-bulk inserter keeps for itself (out
+ * of the FSM) after a multi-page relation extension.
+ */
+#define HEAP_RESERVED_EXTENSION_BLOCKS	4
+
+/*
+ * GetReservedExtensionBlock - consume one of this backend's privately
+ * reserved extension blocks, or return InvalidBlockNumber if none remain.
+ */
+static BlockNumber
+GetReservedExtensionBlock(Relation relation)
+{
+	SMgrRelation smgr = RelationGetSmgr(relation);
+	BlockNumber blk = smgr->smgr_reservedblock;
+
+	if (!BlockNumberIsValid(blk))
+		return InvalidBlockNumber;
+
+	if (blk >= smgr->smgr_lastreservedblock)
+	{
+		smgr->smgr_reservedblock = InvalidBlockNumber;
+		smgr->smgr_lastreservedblock = InvalidBlockNumber;
+	}
+	else
+		smgr->smgr_reservedblock++;
+
+	return blk;
+}
 
 /*
  * RelationPutHeapTuple - place tuple at specified page
@@ -321,7 +350,16 @@ RelationAddBlocks(Relation relation, BulkInsertState bistate,
 	 * Never enter the page returned into the FSM, we'll immediately use it.
 	 */
 	if (num_pages > 1 && bistate == NULL)
-		not_in_fsm_pages = 1;
+	{
+		/*
+		 * Withhold a few of the extra pages from the FSM as well, remembered
+		 * in the smgr cache below: that gives this backend private insertion
+		 * candidates, so a herd of concurrent inserters doesn't chase the
+		 * same FSM slots page by page.
+		 */
+		not_in_fsm_pages = Min(extend_by_pages,
+							   1 + HEAP_RESERVED_EXTENSION_BLOCKS);
+	}
 	else
 		not_in_fsm_pages = num_pages;
 
@@ -441,6 +479,19 @@ RelationAddBlocks(Relation relation, BulkInsertState bistate,
 		bistate->current_buf = buffer;
 		bistate->already_extended_by += extend_by_pages;
 	}
+	else if (not_in_fsm_pages > 1)
+	{
+		SMgrRelation smgr = RelationGetSmgr(relation);
+
+		/*
+		 * Remember the withheld pages (all but the returned first block) as
+		 * this backend's private insertion candidates.  Any previously
+		 * remembered range is simply overwritten; such pages are found again
+		 * by vacuum and re-entered into the FSM eventually.
+		 */
+		smgr->smgr_reservedblock = first_block + 1;
+		smgr->smgr_lastreservedblock = first_block + not_in_fsm_pages - 1;
+	}
 
 	return buffer;
 #undef MAX_BUFFERS_TO_EXTEND_BY
@@ -588,6 +639,10 @@ RelationGetBufferForTuple(Relation relation, Size len,
 	else
 		targetBlock = RelationGetTargetBlock(relation);
 
+	/* a block reserved by an earlier bulk extension is next best */
+	if (targetBlock == InvalidBlockNumber)
+		targetBlock = GetReservedExtensionBlock(relation);
+
 	if (targetBlock == InvalidBlockNumber && use_fsm)
 	{
 		/*
@@ -779,14 +834,29 @@ loop:
 		}
 		else
 		{
-			/*
-			 * Update FSM as to condition of this page, and ask for another
-			 * page to try.
-			 */
-			targetBlock = RecordAndGetPageWithFreeSpace(relation,
-														targetBlock,
-														pageFreeSpace,
-														targetFreeSpace);
+			BlockNumber reserved = GetReservedExtensionBlock(relation);
+
+			if (BlockNumberIsValid(reserved))
+			{
+				/*
+				 * Use one of our privately reserved new pages instead of
+				 * walking the FSM again, but still record this page's free
+				 * space for narrower tuples.
+				 */
+				RecordPageWithFreeSpace(relation, targetBlock, pageFreeSpace);
+				targetBlock = reserved;
+			}
+			else
+			{
+				/*
+				 * Update FSM as to condition of this page, and ask for
+				 * another page to try.
+				 */
+				targetBlock = RecordAndGetPageWithFreeSpace(relation,
+															targetBlock,
+															pageFreeSpace,
+															targetFreeSpace);
+			}
 		}
 	}
 
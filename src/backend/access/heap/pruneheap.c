@@ -176,6 +176,31 @@ static void heap_prune_record_unchanged_lp_redirect(PruneState *prstate, OffsetN
 
 static void page_verify_redirects(Page page);
 
+/*
+ * Read-side long-HOT-chain reporting.
+ *
+ * heap_hot_search_buffer() tells us (via heap_prune_record_long_chain)
+ * when it had to walk an unusually long HOT chain.  Pruning would collapse
+ * the chain to a single redirect, but heap_page_prune_opt()'s normal
+ * heuristic only fires when page free space is low -- which update-heavy
+ * queue tables with short rows may never hit, leaving every reader walking
+ * the chains forever.  We remember one (relation, block) pair per backend;
+ * the next heap_page_prune_opt() visit to that page prunes regardless of
+ * free space.  One slot is enough, since the very next fetch of the same
+ * hot page typically re-reports it.  Note that pruning acts on the whole
+ * page, so one long chain is enough to collapse all of them.  The chain
+ * length that counts as "long" is HEAP_LONG_CHAIN_THRESHOLD (heapam.h).
+ */
+static Oid	long_chain_relid = InvalidOid;
+static BlockNumber long_chain_blkno = InvalidBlockNumber;
+
+void
+heap_prune_record_long_chain(Relation relation, BlockNumber blkno)
+{
+	long_chain_relid = RelationGetRelid(relation);
+	long_chain_blkno = blkno;
+}
+
 /*
  * Optionally prune and repair fragmentation in the specified page.
  *
@@ -243,6 +268,33 @@ heap_page_prune_opt(Relation relation, Buffer buffer)
 											 HEAP_DEFAULT_FILLFACTOR);
 	minfree = Max(minfree, BLCKSZ / 10);
 
+	/* Did a reader report a long HOT chain on this very page? */
+	if (long_chain_blkno == BufferGetBlockNumber(buffer) &&
+		long_chain_relid == RelationGetRelid(relation))
+	{
+		/* consume the hint; it'll be re-reported if the page stays bad */
+		long_chain_relid = InvalidOid;
+		long_chain_blkno = InvalidBlockNumber;
+
+		if (ConditionalLockBufferForCleanup(buffer))
+		{
+			OffsetNumber dummy_off_loc;
+			PruneFreezeResult presult;
+
+			heap_page_prune_and_freeze(relation, buffer, vistest, 0,
+									   NULL, &presult, PRUNE_ON_ACCESS,
+									   &dummy_off_loc, NULL, NULL, true);
+
+			/* see the free-space-driven path below about this accounting */
+			if (presult.ndeleted > presult.nnewlpdead)
+				pgstat_update_heap_dead_tuples(relation,
+											   presult.ndeleted - presult.nnewlpdead);
+
+			LockBuffer(buffer, BUFFER_LOCK_UNLOCK);
+		}
+		return;
+	}
+
 	if (PageIsFull(page) || PageGetHeapFreeSpace(page) < minfree)
 	{
 		/* OK, try to get exclusive buffer lock */
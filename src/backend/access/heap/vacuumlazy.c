@@ -1196,6 +1196,19 @@ heap_vacuum_rel(Relation rel, const VacuumParams params,
  *		However, we process indexes in full every time lazy_vacuum is called,
  *		which makes index processing very inefficient when memory is in short
  *		supply.
+ *
+ *		Unlike index vacuuming, this phase is not parallelized.  Splitting
+ *		the scan into per-worker block ranges is conceptually easy (each
+ *		worker would run its own read stream, with dead items merged into
+ *		the shared TidStore), but several pieces of state are serial today:
+ *		the skip-pages logic and next_unskippable_block tracking, the
+ *		relfrozenxid/relminmxid tracking in vacrel which assumes a single
+ *		monotonic pass, the FSM vacuuming cadence (VACUUM_FSM_EVERY_PAGES),
+ *		the failsafe checks, and the one-pass (no-indexes) strategy which
+ *		intertwines pruning with immediate reclaim.  Whoever parallelizes
+ *		this should start by making those pieces range-local and merging
+ *		the per-range aggregates (oldest observed xid/mxid, counts) at the
+ *		end of the scan, the way parallel index builds merge worker stats.
  */
 static void
 lazy_scan_heap(LVRelState *vacrel)
@@ -53,6 +53,24 @@
  * VACUUM will normally skip pages for which the visibility map bit is set;
  * such pages can't contain any dead tuples and therefore don't need vacuuming.
  *
+ * A recurring complaint is that a single update "poisons" its page for
+ * index-only scans until the next vacuum, and proposals follow to add
+ * finer-grained state here -- a per-page modification epoch, or sub-page
+ * visibility bits -- so IOS could skip heap fetches for tuples older than
+ * the page's latest change.  That doesn't work with the map's one-sided
+ * contract: a set bit is a promise, a clear bit says nothing, and
+ * crash-safety only has to preserve promises (clearing is redone with the
+ * page modification; setting is WAL-logged by vacuum).  Any "modified
+ * recently at xid X" annotation would be a statement whose staleness after
+ * a crash gives wrong answers, so it would need full WAL coverage on the
+ * update path -- adding write amplification to every update to speed up
+ * some reads.  Moreover an index tuple alone can't tell you its heap
+ * tuple's age: the xmin that would be compared against such an epoch lives
+ * in the heap tuple you were trying not to fetch.  The productive
+ * direction is instead making the existing bit come back faster after
+ * updates, i.e. more eager opportunistic setting of all-visible after
+ * pruning, which needs no format change.
+ *
  * LOCKING
  *
  * In heapam.c, whenever a page is modified so that not all tuples on the
@@ -24,6 +24,7 @@
 #include "utils/datum.h"
 #include "utils/float.h"
 #include "utils/lsyscache.h"
+#include "utils/spccache.h"
 #include "utils/memutils.h"
 #include "utils/rel.h"
 
@@ -108,6 +109,21 @@ static void
 spgAddSearchItemToQueue(SpGistScanOpaque so, SpGistSearchItem *item)
 {
 	pairingheap_add(so->scanQueue, &item->phNode);
+
+	/*
+	 * Start reading the page this item will visit.  Descents into cold
+	 * inner pages otherwise pay one synchronous read per level; issuing
+	 * the readahead when the child enters the queue overlaps that I/O
+	 * with examining the current page.  Leaf heap items (ordered scans)
+	 * carry heap TIDs, not index pages, so they don't participate.
+	 */
+	if (!item->isLeaf &&
+		so->prefetchPending < so->prefetchDistance)
+	{
+		PrefetchBuffer(so->state.index, MAIN_FORKNUM,
+					   ItemPointerGetBlockNumber(&item->heapPtr));
+		so->prefetchPending++;
+	}
 }
 
 static SpGistSearchItem *
@@ -310,6 +326,8 @@ spgbeginscan(Relation rel, int keysz, int orderbysz)
 	scan = RelationGetIndexScan(rel, keysz, orderbysz);
 
 	so = (SpGistScanOpaque) palloc0(sizeof(SpGistScanOpaqueData));
+	so->prefetchDistance =
+		get_tablespace_io_concurrency(rel->rd_rel->reltablespace);
 	if (keysz > 0)
 		so->keyData = (ScanKey) palloc(sizeof(ScanKeyData) * keysz);
 	else
@@ -416,6 +434,9 @@ spgrescan(IndexScanDesc scan, ScanKey scankey, int nscankeys,
 	/* preprocess scankeys, set up the representation in *so */
 	spgPrepareScanKeys(scan);
 
+	/* fresh scan, fresh readahead budget */
+	so->prefetchPending = 0;
+
 	/* set up starting queue entries */
 	resetSpGistScanOpaque(so);
 
@@ -851,12 +872,14 @@ redirect:
 			{
 				buffer = ReadBuffer(index, blkno);
 				LockBuffer(buffer, BUFFER_LOCK_SHARE);
+				so->prefetchPending = 0;
 			}
 			else if (blkno != BufferGetBlockNumber(buffer))
 			{
 				UnlockReleaseBuffer(buffer);
 				buffer = ReadBuffer(index, blkno);
 				LockBuffer(buffer, BUFFER_LOCK_SHARE);
+				so->prefetchPending = 0;
 			}
 
 			/* else new pointer points to the same page, no work needed */
@@ -367,6 +367,36 @@ typedef struct mXactCacheEnt
 static dclist_head MXactCache = DCLIST_STATIC_INIT(MXactCache);
 static MemoryContext MXactContext = NULL;
 
+/*
+ * Shared cache of recently resolved multixacts.
+ *
+ * When many backends scan recently share-locked rows (FK-heavy workloads),
+ * they all resolve the same few multixacts, and the per-backend cache above
+ * doesn't help the first lookup in each backend; everyone piles onto the
+ * offset/member SLRU bank locks instead.  This is a small, fixed shared
+ * cache in front of the SLRUs: direct-mapped by multixact id, each slot
+ * protected by its own seqlock-style version counter (odd = being
+ * written), so readers never take a lock and writers never block.  Only
+ * multixacts with few members are cached, which covers the common
+ * lockers-only case; anything larger just goes to the SLRU as before.
+ * Member sets of a given multixact never change, so a consistent read is
+ * trustworthy with no invalidation protocol.
+ */
+#define SHARED_MXACT_CACHE_SLOTS	512 /* must be a power of 2 */
+#define SHARED_MXACT_CACHE_MEMBERS	8
+
+typedef struct SharedMXactCacheEnt
+{
+	pg_atomic_uint32 version;	/* seqlock; odd while being updated */
+	MultiXactId multi;
+	int			nmembers;
+	MultiXactMember members[SHARED_MXACT_CACHE_MEMBERS];
+} SharedMXactCacheEnt;
+
+static SharedMXactCacheEnt *SharedMXactCache = NULL;
+
+#define SharedMXactCacheSlot(multi) 	(&SharedMXactCache[(multi) & (SHARED_MXACT_CACHE_SLOTS - 1)])
+
 #ifdef MULTIXACT_DEBUG
 #define debug_elog2(a,b) elog(a,b)
 #define debug_elog3(a,b,c) elog(a,b,c)
@@ -388,6 +418,9 @@ static void RecordNewMultiXact(MultiXactId multi, MultiXactOffset offset,
 static MultiXactId GetNewMultiXactId(int nmembers, MultiXactOffset *offset);
 
 /* MultiXact cache management */
+static int	SharedMXactCacheGet(MultiXactId multi, MultiXactMember **members);
+static void SharedMXactCachePut(MultiXactId multi, int nmembers,
+								MultiXactMember *members);
 static int	mxactMemberComparator(const void *arg1, const void *arg2);
 static MultiXactId mXactCacheGetBySet(int nmembers, MultiXactMember *members);
 static int	mXactCacheGetById(MultiXactId multi, MultiXactMember **members);
@@ -1198,6 +1231,16 @@ GetMultiXactIdMembers(MultiXactId multi, MultiXactMember **members,
 		return length;
 	}
 
+	/* Likewise try the shared cache of hot multixacts */
+	length = SharedMXactCacheGet(multi, members);
+	if (length >= 0)
+	{
+		debug_elog3(DEBUG2, "GetMembers: found %s in the shared cache",
+					mxid_to_string(multi, length, *members));
+		mXactCachePut(multi, length, *members);
+		return length;
+	}
+
 	/* Set our OldestVisibleMXactId[] entry if we didn't already */
 	MultiXactIdSetOldestVisible();
 
@@ -1437,9 +1480,11 @@ retry:
 	Assert(truelength > 0);
 
 	/*
-	 * Copy the result into the local cache.
+	 * Copy the result into the local cache, and make it visible to other
+	 * backends through the shared cache.
 	 */
 	mXactCachePut(multi, truelength, ptr);
+	SharedMXactCachePut(multi, truelength, ptr);
 
 	debug_elog3(DEBUG2, "GetMembers: no cache for %s",
 				mxid_to_string(multi, truelength, ptr));
@@ -1447,6 +1492,79 @@ retry:
 	return truelength;
 }
 
+/*
+ * SharedMXactCacheGet
+ *		Look up a multixact's member array in the shared cache.
+ *
+ * On success returns the number of members and sets *members to a palloc'd
+ * copy (in the caller's context, like mXactCacheGetById); returns -1 on
+ * cache miss.  Readers use the slot's version counter seqlock-style: if the
+ * version is odd, or changes across the copy, somebody was overwriting the
+ * slot and we just report a miss.
+ */
+static int
+SharedMXactCacheGet(MultiXactId multi, MultiXactMember **members)
+{
+	SharedMXactCacheEnt *ent = SharedMXactCacheSlot(multi);
+	MultiXactMember local[SHARED_MXACT_CACHE_MEMBERS];
+	int			nmembers;
+	uint32		v1;
+	uint32		v2;
+
+	v1 = pg_atomic_read_u32(&ent->version);
+	if (v1 & 1)
+		return -1;
+	pg_read_barrier();
+
+	if (ent->multi != multi)
+		return -1;
+	nmembers = ent->nmembers;
+	if (nmembers <= 0 || nmembers > SHARED_MXACT_CACHE_MEMBERS)
+		return -1;				/* torn read; treat as miss */
+	memcpy(local, ent->members, nmembers * sizeof(MultiXactMember));
+
+	pg_read_barrier();
+	v2 = pg_atomic_read_u32(&ent->version);
+	if (v1 != v2)
+		return -1;
+
+	*members = palloc(nmembers * sizeof(MultiXactMember));
+	memcpy(*members, local, nmembers * sizeof(MultiXactMember));
+
+	return nmembers;
+}
+
+/*
+ * SharedMXactCachePut
+ *		Publish a freshly resolved multixact into the shared cache.
+ *
+ * Writers claim the slot by moving its version from even to odd with a
+ * CAS; if that fails someone else is writing, and we just skip publishing
+ * rather than wait.
+ */
+static void
+SharedMXactCachePut(MultiXactId multi, int nmembers, MultiXactMember *members)
+{
+	SharedMXactCacheEnt *ent = SharedMXactCacheSlot(multi);
+	uint32		version;
+
+	if (nmembers <= 0 || nmembers > SHARED_MXACT_CACHE_MEMBERS)
+		return;
+
+	version = pg_atomic_read_u32(&ent->version);
+	if (version & 1)
+		return;
+	if (!pg_atomic_compare_exchange_u32(&ent->version, &version, version + 1))
+		return;
+
+	ent->multi = multi;
+	ent->nmembers = nmembers;
+	memcpy(ent->members, members, nmembers * sizeof(MultiXactMember));
+
+	pg_write_barrier();
+	pg_atomic_write_u32(&ent->version, version + 2);
+}
+
 /*
  * mxactMemberComparator
  *		qsort comparison function for MultiXactMember
@@ -1828,6 +1946,8 @@ MultiXactShmemSize(void)
 	size = SHARED_MULTIXACT_STATE_SIZE;
 	size = add_size(size, SimpleLruShmemSize(multixact_offset_buffers, 0));
 	size = add_size(size, SimpleLruShmemSize(multixact_member_buffers, 0));
+	size = add_size(size, mul_size(SHARED_MXACT_CACHE_SLOTS,
+								   sizeof(SharedMXactCacheEnt)));
 
 	return size;
 }
@@ -1872,6 +1992,20 @@ MultiXactShmemInit(void)
 	else
 		Assert(found);
 
+	/* Create or attach to the shared multixact lookup cache */
+	SharedMXactCache = (SharedMXactCacheEnt *)
+		ShmemInitStruct("Shared MultiXact Cache",
+						mul_size(SHARED_MXACT_CACHE_SLOTS,
+								 sizeof(SharedMXactCacheEnt)),
+						&found);
+	if (!IsUnderPostmaster)
+	{
+		MemSet(SharedMXactCache, 0,
+			   SHARED_MXACT_CACHE_SLOTS * sizeof(SharedMXactCacheEnt));
+		for (int i = 0; i < SHARED_MXACT_CACHE_SLOTS; i++)
+			pg_atomic_init_u32(&SharedMXactCache[i].version, 0);
+	}
+
 	/*
 	 * Set up array pointers.
 	 */
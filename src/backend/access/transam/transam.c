@@ -30,9 +30,31 @@
  * same XID, for example when scanning a table just after a bulk insert,
  * update, or delete.
  */
-static TransactionId cachedFetchXid = InvalidTransactionId;
-static XidStatus cachedFetchXidStatus;
-static XLogRecPtr cachedCommitLSN;
+/*
+ * Backend-local cache of recently looked-up transaction statuses.  Only
+ * states that can never change again (committed/aborted) are cached, so no
+ * invalidation is ever needed.  The cache is direct-mapped by xid; scans of
+ * freshly written data tend to see the same small set of xids over and over,
+ * and each hit saves a CLOG bank lock acquisition in clog.c.  An
+ * InvalidTransactionId xid marks an empty slot.
+ *
+ * As with the single-entry cache this replaces, entries don't carry an
+ * epoch: we rely on the anti-wraparound machinery freezing any reference
+ * to an xid long before the xid can be reused, so a status lookup for a
+ * given xid value can't straddle two incarnations of that value.
+ */
+#define NUM_CACHED_XID_STATUS	256 /* must be a power of 2 */
+
+typedef struct CachedXidStatusEntry
+{
+	TransactionId xid;			/* cached xid, or InvalidTransactionId */
+	XidStatus	status;			/* its permanent status */
+	XLogRecPtr	commitLSN;		/* commit record LSN, if applicable */
+} CachedXidStatusEntry;
+
+static CachedXidStatusEntry cachedFetchStatus[NUM_CACHED_XID_STATUS];
+
+#define CachedXidStatusSlot(xid) 	(&cachedFetchStatus[(xid) & (NUM_CACHED_XID_STATUS - 1)])
 
 /* Local functions */
 static XidStatus TransactionLogFetch(TransactionId transactionId);
@@ -54,12 +76,14 @@ TransactionLogFetch(TransactionId transactionId)
 	XidStatus	xidstatus;
 	XLogRecPtr	xidlsn;
 
+	CachedXidStatusEntry *entry = CachedXidStatusSlot(transactionId);
+
 	/*
-	 * Before going to the commit log manager, check our single item cache to
-	 * see if we didn't just check the transaction status a moment ago.
+	 * Before going to the commit log manager, check our local cache to see
+	 * if we didn't check this transaction's status a moment ago.
 	 */
-	if (TransactionIdEquals(transactionId, cachedFetchXid))
-		return cachedFetchXidStatus;
+	if (TransactionIdEquals(transactionId, entry->xid))
+		return entry->status;
 
 	/*
 	 * Also, check to see if the transaction ID is a permanent one.
@@ -85,9 +109,9 @@ TransactionLogFetch(TransactionId transactionId)
 	if (xidstatus != TRANSACTION_STATUS_IN_PROGRESS &&
 		xidstatus != TRANSACTION_STATUS_SUB_COMMITTED)
 	{
-		cachedFetchXid = transactionId;
-		cachedFetchXidStatus = xidstatus;
-		cachedCommitLSN = xidlsn;
+		entry->xid = transactionId;
+		entry->status = xidstatus;
+		entry->commitLSN = xidlsn;
 	}
 
 	return xidstatus;
@@ -389,8 +413,12 @@ TransactionIdGetCommitLSN(TransactionId xid)
 	 * checking TransactionLogFetch's cache will usually succeed and avoid an
 	 * extra trip to shared memory.
 	 */
-	if (TransactionIdEquals(xid, cachedFetchXid))
-		return cachedCommitLSN;
+	{
+		CachedXidStatusEntry *entry = CachedXidStatusSlot(xid);
+
+		if (TransactionIdEquals(xid, entry->xid))
+			return entry->commitLSN;
+	}
 
 	/* Special XIDs are always known committed */
 	if (!TransactionIdIsNormal(xid))
@@ -72,6 +72,23 @@ VarsupShmemInit(void)
  * transaction, since XIDs are now not allocated until the transaction
  * does something.  So it is safe to do a database lookup if we want to
  * issue a warning about XID wrap.
+ *
+ * Why xids aren't handed out in per-backend ranges the way OIDs are
+ * (cf. GetNewObjectId's caching): unlike an OID, an xid is a visibility
+ * ordering statement.  GetSnapshotData computes xmax from the advertised
+ * next xid with the guarantee that no xid >= xmax can be running; if
+ * backends drew from private ranges, a backend could begin using an xid
+ * *below* another snapshot's xmax without ever having been visible in
+ * the proc array when that snapshot was taken, and the snapshot would
+ * deem it aborted.  Closing that hole requires advertising the whole
+ * reserved range as potentially-running, which pushes every snapshot's
+ * xmin back by (range size x backends) and delays vacuum horizons
+ * accordingly -- trading the XidGenLock hold (a handful of instructions,
+ * plus occasional CLOG page zeroing that range reservation wouldn't
+ * avoid anyway) for globally worse bloat behavior.  The profile cost of
+ * this function under write bursts is dominated by the ExtendCLOG/
+ * ExtendSUBTRANS calls, which batching per-backend wouldn't remove --
+ * they're already amortized across 32K-xid pages.
  */
 FullTransactionId
 GetNewTransactionId(bool isSubXact)
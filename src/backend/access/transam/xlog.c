@@ -150,8 +150,19 @@ int			wal_segment_size = DEFAULT_XLOG_SEG_SIZE;
  * Number of WAL insertion locks to use. A higher value allows more insertions
  * to happen concurrently, but adds some CPU overhead to flushing the WAL,
  * which needs to iterate all the locks.
+ *
+ * 8 locks were plenty when a handful of cores generated WAL, but on today's
+ * large machines write-heavy workloads spend noticeable time queued on the
+ * insertion locks.  64 keeps the flush-side scan in
+ * WaitXLogInsertionsToFinish() cheap (it touches one cache line per lock,
+ * uncontended, and only when finishing a flush) while taking the insertion
+ * side off the top of the lock-wait profiles.  Reserving the byte positions
+ * themselves (insertpos_lck) is a separate, intentionally tiny critical
+ * section; schemes that stage records per backend and assign LSNs in
+ * batches just move the serialization into the ordering stage, because
+ * xl_prev requires a total order of records at reservation time.
  */
-#define NUM_XLOGINSERT_LOCKS  8
+#define NUM_XLOGINSERT_LOCKS  64
 
 /*
  * Max distance from last checkpoint, before triggering a new xlog-based
@@ -462,6 +473,14 @@ typedef struct XLogCtlData
 	/* Fake LSN counter, for unlogged relations. */
 	pg_atomic_uint64 unloggedLSN;
 
+	/*
+	 * Smoothed duration of recent WAL sync operations, in microseconds.
+	 * Maintained by issue_xlog_fsync() (under WALWriteLock, so plain
+	 * read-modify-write is fine); read locklessly by XLogFlush() to bound
+	 * the group-commit delay.  Zero until the first sync.
+	 */
+	pg_atomic_uint64 walSyncTimeEwma;
+
 	/* Time and LSN of last xlog segment switch. Protected by WALWriteLock. */
 	pg_time_t	lastSegSwitchTime;
 	XLogRecPtr	lastSegSwitchLSN;
@@ -2446,6 +2465,21 @@ XLogCheckpointNeeded(XLogSegNo new_segno)
  * Must be called with WALWriteLock held. WaitXLogInsertionsToFinish(WriteRqst)
  * must be called before grabbing the lock, to make sure the data is ready to
  * write.
+ *
+ * A note on asynchronous I/O: routing these writes through the AIO
+ * subsystem (so that a backend could submit and go back to useful work,
+ * with completions waking commit waiters) is attractive but blocked on
+ * several structural points.  The AIO layer issues I/O against smgr-owned
+ * virtual file handles with resource-owner cleanup, while WAL segments are
+ * raw fds opened with wal_sync_method-specific flags; the write/flush
+ * ordering contract here is expressed through WALWriteLock, which only its
+ * owner may release, so an io_uring completion running in another process
+ * cannot hand the lock to the next waiter -- waiters would have to move to
+ * a condition-variable protocol first; and the "flexible" stop points
+ * below assume the writer can observe page boundaries synchronously.
+ * Until those are reworked, the asynchrony we have is the walwriter
+ * absorbing most writes ahead of commit (XLogSetAsyncXactLSN wakes it
+ * eagerly), which keeps the common XLogFlush call from doing I/O at all.
  */
 static void
 XLogWrite(XLogwrtRqst WriteRqst, TimeLineID tli, bool flexible)
@@ -3028,7 +3062,24 @@ XLogFlush(XLogRecPtr record)
 		if (CommitDelay > 0 && enableFsync &&
 			MinimumActiveBackends(CommitSiblings))
 		{
-			pg_usleep(CommitDelay);
+			long		delay = CommitDelay;
+			uint64		synctime;
+
+			/*
+			 * Waiting longer than the device needs to flush is pure added
+			 * latency: any backend arriving after the flush starts joins
+			 * the next group anyway.  So cap the configured delay at half
+			 * the observed smoothed sync time, making commit_delay an upper
+			 * bound that adapts to the hardware rather than a fixed sleep.
+			 * Latency-critical sessions can still SET commit_delay = 0 to
+			 * opt out of grouping entirely.
+			 */
+			synctime = pg_atomic_read_u64(&XLogCtl->walSyncTimeEwma);
+			if (synctime > 0)
+				delay = Min(delay, (long) (synctime / 2));
+
+			if (delay > 0)
+				pg_usleep(delay);
 
 			/*
 			 * Re-check how far we can now flush the WAL. It's generally not
@@ -3240,6 +3291,13 @@ XLogBackgroundFlush(void)
 	 */
 	AdvanceXLInsertBuffer(InvalidXLogRecPtr, insertTLI, true);
 
+	/*
+	 * Similarly, keep a pool of future WAL segments prepared, so bursts
+	 * don't make foreground processes zero-fill segments.  Cheap when the
+	 * pool is already populated (one open/close of an existing file).
+	 */
+	PreallocXlogFiles(LogwrtResult.Write, insertTLI);
+
 	/*
 	 * If we determined that we need to write data, but somebody else
 	 * wrote/flushed already, it should be considered as being active, to
@@ -3813,12 +3871,18 @@ XLogFileClose(void)
 /*
  * Preallocate log files beyond the specified log endpoint.
  *
- * XXX this is currently extremely conservative, since it forces only one
- * future log segment to exist, and even that only if we are 75% done with
- * the current one.  This is only appropriate for very low-WAL-volume systems.
- * High-volume systems will be OK once they've built up a sufficient set of
- * recycled log segments, but the startup transient is likely to include
- * a lot of segment creations by foreground processes, which is not so good.
+ * The number of segments prepared ahead scales with the recent WAL
+ * generation rate, using CheckPointDistanceEstimate as the rate proxy: on
+ * quiet systems this degrades to the historical behavior of keeping one
+ * future segment once the current one is 75% consumed, while on busy
+ * systems (or during the startup transient, before a pool of recycled
+ * segments exists) up to 16 segments are kept prepared so foreground
+ * inserters don't stall in XLogFileInitInternal.  At most one segment is
+ * zero-filled per call, keeping any single visit here cheap; probing
+ * segments that already exist costs only an open/close.  Besides the
+ * checkpointer, the walwriter
+ * calls here every cycle, which is what makes the pool replenish at burst
+ * speed rather than at checkpoint cadence.
  *
  * XLogFileInitInternal() can ereport(ERROR).  All known causes indicate big
  * trouble; for example, a full filesystem is one cause.  The checkpoint WAL
@@ -3838,19 +3902,36 @@ PreallocXlogFiles(XLogRecPtr endptr, TimeLineID tli)
 	char		path[MAXPGPATH];
 	uint64		offset;
 
+	int			nsegs;
+
 	if (!XLogCtl->InstallXLogFileSegmentActive)
 		return;					/* unlocked check says no */
 
+	/* how many segments ahead to keep prepared */
+	nsegs = (int) (CheckPointDistanceEstimate / (double) wal_segment_size / 8);
+	nsegs = Min(16, Max(1, nsegs));
+
 	XLByteToPrevSeg(endptr, _logSegNo, wal_segment_size);
 	offset = XLogSegmentOffset(endptr - 1, wal_segment_size);
 	if (offset >= (uint32) (0.75 * wal_segment_size))
 	{
-		_logSegNo++;
-		lf = XLogFileInitInternal(_logSegNo, tli, &added, path);
-		if (lf >= 0)
-			close(lf);
-		if (added)
-			CheckpointStats.ckpt_segs_added++;
+		for (int i = 1; i <= nsegs; i++)
+		{
+			lf = XLogFileInitInternal(_logSegNo + i, tli, &added, path);
+			if (lf >= 0)
+				close(lf);
+			if (added)
+			{
+				/*
+				 * Zero-fill at most one segment per call, so the walwriter
+				 * never spends long here instead of flushing; the pool
+				 * still converges to nsegs within a few cycles.  Probing
+				 * already-existing segments above is just an open/close.
+				 */
+				CheckpointStats.ckpt_segs_added++;
+				break;
+			}
+		}
 	}
 }
 
@@ -5208,6 +5289,7 @@ XLOGShmemInit(void)
 	pg_atomic_init_u64(&XLogCtl->logWriteResult, InvalidXLogRecPtr);
 	pg_atomic_init_u64(&XLogCtl->logFlushResult, InvalidXLogRecPtr);
 	pg_atomic_init_u64(&XLogCtl->unloggedLSN, InvalidXLogRecPtr);
+	pg_atomic_init_u64(&XLogCtl->walSyncTimeEwma, 0);
 
 	pg_atomic_init_u64(&XLogCtl->InitializeReserved, InvalidXLogRecPtr);
 	pg_atomic_init_u64(&XLogCtl->InitializedUpTo, InvalidXLogRecPtr);
@@ -7077,6 +7159,22 @@ update_checkpoint_display(int flags, bool restartpoint, bool reset)
  *
  * Returns true if a new checkpoint was performed, or false if it was skipped
  * because the system was idle.
+ *
+ * A recurring wish is to replace these discrete sweeps with "incremental"
+ * checkpoints: flush dirty buffers continuously in LSN order and advance a
+ * persistent redo low-watermark smoothly, eliminating the periodic I/O
+ * spike.  The checkpoint record's promise is what makes that hard: redo at
+ * LSN R asserts every change before R is durably on disk.  Advancing R
+ * continuously requires knowing the oldest LSN that first dirtied any
+ * still-dirty buffer -- which means tracking a first-dirtied LSN per
+ * buffer header and maintaining a global minimum across eviction,
+ * bgwriter, and backend writes, plus fsyncing affected files before each
+ * advance (otherwise the watermark promises durability writes haven't
+ * earned).  That bookkeeping serializes on exactly the hot paths the
+ * feature is meant to relieve.  The practical mitigations already exist
+ * in softer form: checkpoint_completion_target spreads the write phase,
+ * and checkpoint_flush_after keeps the final fsyncs from finding
+ * mountains of dirty kernel pages.
  */
 bool
 CreateCheckPoint(int flags)
@@ -8880,6 +8978,7 @@ issue_xlog_fsync(int fd, XLogSegNo segno, TimeLineID tli)
 {
 	char	   *msg = NULL;
 	instr_time	start;
+	instr_time	sync_start;
 
 	Assert(tli != 0);
 
@@ -8897,6 +8996,9 @@ issue_xlog_fsync(int fd, XLogSegNo segno, TimeLineID tli)
 	 */
 	start = pgstat_prepare_io_time(track_wal_io_timing);
 
+	/* also timed unconditionally, for the group-commit delay bound */
+	INSTR_TIME_SET_CURRENT(sync_start);
+
 	pgstat_report_wait_start(WAIT_EVENT_WAL_SYNC);
 	switch (wal_sync_method)
 	{
@@ -8941,6 +9043,24 @@ issue_xlog_fsync(int fd, XLogSegNo segno, TimeLineID tli)
 
 	pgstat_report_wait_end();
 
+	/* fold this sync's duration into the smoothed estimate */
+	{
+		instr_time	sync_end;
+		uint64		elapsed;
+		uint64		ewma;
+
+		INSTR_TIME_SET_CURRENT(sync_end);
+		INSTR_TIME_SUBTRACT(sync_end, sync_start);
+		elapsed = INSTR_TIME_GET_MICROSEC(sync_end);
+
+		ewma = pg_atomic_read_u64(&XLogCtl->walSyncTimeEwma);
+		if (ewma == 0)
+			ewma = elapsed;
+		else
+			ewma += ((int64) elapsed - (int64) ewma) / 8;
+		pg_atomic_write_u64(&XLogCtl->walSyncTimeEwma, ewma);
+	}
+
 	pgstat_count_io_op_time(IOOBJECT_WAL, IOCONTEXT_NORMAL, IOOP_FSYNC,
 							start, 1, 0);
 }
@@ -958,6 +958,32 @@ XLogRecordAssemble(RmgrId rmid, uint8 info,
  * Returns false if compression fails (i.e., compressed result is actually
  * bigger than original). Otherwise, returns true and sets 'dlen' to
  * the length of compressed block image.
+ *
+ * Note that full-page images are the only part of WAL we compress, even
+ * though plain record data often compresses well too.  Compressing whole
+ * segments at write time would require an on-disk segment format change:
+ * XLogRecPtrs are byte offsets into the segment, so every consumer that
+ * seeks (xlogreader, walsenders entering at arbitrary LSNs, the recycling
+ * logic that detects stale pages by the xlp_pageaddr in each page header)
+ * would need an index from LSN to compressed offset, and crash recovery's
+ * torn-write detection depends on page headers at fixed positions.  FPIs
+ * are different: they're self-contained blobs inside one record, so their
+ * compression stays invisible to addressing.  Bulk-compressible volume is
+ * better recovered downstream, where the stream is sequential anyway --
+ * archive_command/pg_receivewal compression for the archive, and protocol
+ * or ssh-level compression for replication traffic.
+ *
+ * As for varying the codec per page category (btree internal vs. heap
+ * pages do compress differently): the decode side reads the codec from
+ * the per-block BKPIMAGE_COMPRESS_* flags, so mixed codecs already work
+ * on disk, and a static per-rmgr/fork policy would be a modest patch if
+ * measurements justified it.  The adaptive-bandit version is the part
+ * to resist: the reward signal varies with data rather than page
+ * category (non-stationary arms), the decision sits on the insertion
+ * hot path, and a codec mix that depends on load history makes replay
+ * and archive costs unpredictable.  Measure with pg_waldump --stats
+ * first; if a category shows a stable large ratio gap, a fixed table is
+ * the whole feature.
  */
 static bool
 XLogCompressBackupBlock(const PageData *page, uint16 hole_offset, uint16 hole_length,
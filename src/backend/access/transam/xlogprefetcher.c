@@ -22,6 +22,23 @@
  * prefetching is only effective on systems where PrefetchBuffer() does
  * something useful (mainly Linux).
  *
+ * A sometimes-requested extension is the reverse flow: publish the
+ * upcoming-block set so that backend victim selection avoids evicting
+ * pages redo is about to touch.  Two reasons that's weaker than it
+ * sounds.  First, the prefetcher's own PrefetchBuffer() calls put the
+ * upcoming pages at the freshest end of the clock already -- a page
+ * prefetched into the pool has usage_count protection like any other
+ * recent access, so eviction of imminently-needed pages is mostly the
+ * symptom of a pool too small for redo's working set plus queries, which
+ * no advisory bit fixes.  Second, a backend consulting a shared
+ * do-not-evict set in StrategyGetBuffer puts a lookup on the most
+ * contended loop in the server, paid by every allocation on standbys and
+ * primaries alike (or adds a branch to distinguish them, in the same
+ * loop).  The asymmetric costs favor the existing arrangement: redo's
+ * accesses defend their own pages via usage counts, and
+ * maintenance_io_concurrency/wal_decode_buffer_size size how far ahead
+ * redo's protection extends.
+ *
  *-------------------------------------------------------------------------
  */
 
@@ -1658,6 +1658,25 @@ ShutdownWalRecovery(void)
  * Perform WAL recovery.
  *
  * If the system was shut down cleanly, this is never called.
+ *
+ * Redo is applied single-threaded, and that is load-bearing in more places
+ * than the main loop below.  Distributing records across workers keyed by
+ * relfilenumber/block -- the usual parallel-replay sketch -- has to
+ * preserve more than per-page ordering: multi-page records (index splits,
+ * HOT updates with visibility changes) order pages against each other;
+ * records that bump shared state (nextXid, commit records updating CLOG
+ * and the visible-XID horizon, running-xacts snapshots feeding hot
+ * standby) must be applied in LSN order relative to everything they might
+ * be observed against; restartpoints and the consistent-recovery point
+ * assume everything before a record's LSN is applied when it is; and
+ * rm_redo implementations freely assume exclusive access to shared
+ * caches.  So a credible design needs per-rmgr (really per-record-type)
+ * safety classification, a dependency-aware scheduler, and an LSN
+ * watermark protocol for everything that reads recovery progress --
+ * before any of that, profile whether you're I/O-bound: the prefetcher
+ * (xlogprefetcher.c) usually means the single apply thread is limited by
+ * buffer lookups and page-level work, which batching within one process
+ * can attack with far less risk.
  */
 void
 PerformWalRecovery(void)
@@ -1569,6 +1569,22 @@ sendDir(bbsink *sink, const char *path, int basepathlen, bool sizeonly,
  *
  * Returns true if the file was successfully sent, false if 'missing_ok',
  * and the file did not exist.
+ *
+ * On the perennial performance wishes for this path: sendfile/
+ * copy_file_range-style zero-copy can't be used even with checksum
+ * verification off, because every data file page must be examined for
+ * torn-ness against the backup start LSN (the read-retry logic in
+ * verify_page_checksum also papers over concurrent writes), the content
+ * flows into a tar stream at unaligned offsets, and bbsinks may compress
+ * or encrypt.  Parallel file readers need a protocol rework first: the
+ * output is a single ordered tar stream per tablespace, so senders can't
+ * interleave without a multiplexed archive format negotiated with
+ * pg_basebackup -- that, not the reading side, is the place to start
+ * (the server side here would then naturally become one worker per
+ * tablespace).  Meanwhile the knobs that move the needle on a slow
+ * backup are a larger bbsink buffer and running the backup with
+ * pg_basebackup's server-side compression, which shrinks the stream the
+ * single connection must carry.
  */
 static bool
 sendFile(bbsink *sink, const char *readfilename, const char *tarfilename,
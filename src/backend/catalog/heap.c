@@ -1116,6 +1116,23 @@ AddNewRelationType(const char *typeName,
  *	(this must be null if the relkind is one that doesn't get a pg_type entry)
  *
  * Returns the OID of the new relation
+ *
+ * Apropos of the catalog churn that per-session temp tables cause (every
+ * CREATE TEMP TABLE passes through here, bloating pg_class/pg_attribute
+ * and spraying sinval): global temporary tables -- shared catalog entry,
+ * per-backend storage -- are the known cure and have been through several
+ * substantial patch attempts.  What they keep stubbing their toe on is
+ * everything that assumes one relation has one storage and one set of
+ * stats: relfilenode becomes per-backend (so smgr, relcache init and
+ * pg_class.relfilenode all need a session indirection), relpages/
+ * reltuples/pg_statistic become per-backend (planner correctness), and
+ * autovacuum can't see any backend's private heap for xid-horizon
+ * purposes, which needs per-session frozen-xid tracking to avoid
+ * wraparound hazards -- the issue that sank the last major attempt.
+ * Partial mitigations that exist now: temp-table DDL skips WAL and most
+ * fsyncs, ON COMMIT DELETE ROWS reuses the relation across transactions
+ * within a session (do that rather than re-CREATE per transaction!), and
+ * autovacuum handles the catalog bloat if it's allowed to.
  * --------------------------------
  */
 Oid
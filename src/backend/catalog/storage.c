@@ -303,6 +303,8 @@ RelationTruncate(Relation rel, BlockNumber nblocks)
 	 */
 	reln = RelationGetSmgr(rel);
 	reln->smgr_targblock = InvalidBlockNumber;
+	reln->smgr_reservedblock = InvalidBlockNumber;
+	reln->smgr_lastreservedblock = InvalidBlockNumber;
 	for (int i = 0; i <= MAX_FORKNUM; ++i)
 		reln->smgr_cached_nblocks[i] = InvalidBlockNumber;
 
@@ -273,6 +273,24 @@ analyze_rel(Oid relid, RangeVar *relation,
  * Note that "acquirefunc" is only relevant for the non-inherited case.
  * For the inherited case, acquire_inherited_sample_rows() determines the
  * appropriate acquirefunc for each child table.
+ *
+ * On replacing row sampling with a streaming full-pass sketch build
+ * (HLL for ndistinct, t-digest for histograms, heavy-hitters for MCVs,
+ * maintained per column by parallel workers): the estimators here are
+ * knowingly sample-based and some of their failure modes (ndistinct
+ * especially) would indeed improve with full-pass sketches.  What the
+ * proposal trades away is that ANALYZE cost is currently independent of
+ * table size -- a sketch pass reads the whole table, which for exactly
+ * the big tables whose stats are worst turns a 30k-row sample into a
+ * full scan on every autoanalyze.  There are also representational
+ * constraints: pg_statistic rows must hold actual sample *values*
+ * (MCV lists, histogram bounds are datums with their full type
+ * semantics), which t-digest centroids don't yield for non-numeric
+ * types.  The extensible path that exists: wide tables can cut the
+ * 400-column serial cost today with per-column statistics targets
+ * (ALTER TABLE ... SET STATISTICS 0 for never-queried columns), and
+ * ndistinct pain points usually respond to n_distinct manual overrides
+ * -- both cheaper than a new stats pipeline and reversible.
  */
 static void
 do_analyze_rel(Relation onerel, const VacuumParams params,
@@ -1846,6 +1846,25 @@ ProcessNotifyInterrupt(bool flush)
  * Read all pending notifications from the queue, and deliver appropriate
  * ones to my frontend.  Stop when we reach queue head or an uncommitted
  * notification.
+ *
+ * The single global queue means every listener scans every message and
+ * every notify wakes every listening backend, which is the scaling wall
+ * high-channel-count deployments hit.  Why sharding the queue by channel
+ * hash isn't the straightforward fix it looks like: transactional
+ * semantics require all of one transaction's notifications to become
+ * visible atomically at commit and to be delivered to any one listener
+ * in commit order -- with channels of one transaction spread over N
+ * queues, that needs either cross-queue commit sequencing or a
+ * per-transaction atomicity record spanning shards, and a backend
+ * listening to channels in several shards must merge them back into
+ * commit order anyway.  Batching is already present on both ends
+ * (notifications of a transaction are delivered in one pass; duplicate
+ * notifies within a transaction are deduplicated at queue time).  The
+ * deliverable improvement inside this design would be a shared channel
+ * Bloom/summary filter letting SignalBackends skip backends that cannot
+ * match a message's channels -- that cuts the wakeup storm without
+ * touching ordering -- while beyond that, very-high-fanout invalidation
+ * fits dedicated brokers better than a durable SLRU everyone polls.
  */
 static void
 asyncQueueReadAllNotifications(void)
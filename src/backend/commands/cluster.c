@@ -306,6 +306,20 @@ cluster_multiple_rels(List *rtcs, ClusterParams *params)
  * If indexOid is InvalidOid, the table will be rewritten in physical order
  * instead of index order.  This is the new implementation of VACUUM FULL,
  * and error messages should refer to the operation as VACUUM not CLUSTER.
+ *
+ * The online variant (copy concurrently, capture changes through a
+ * logical slot, replay deltas, brief-lock swap) is well understood --
+ * pg_repack and pg_squeeze ship it -- and the reasons it lives outside
+ * this function are worth keeping in mind before in-lining it: delta
+ * replay needs a replica identity to apply updates/deletes to the copy;
+ * the catch-up phase may never converge under sustained write load and
+ * needs abort/retry policy; the final swap must quiesce not just
+ * writers but also any plans holding the old relfilenumber; and DDL
+ * during the window has to be fenced.  Those are policy-heavy,
+ * failure-mode-rich behaviors that extensions can iterate on per
+ * deployment, while this code path keeps the property that matters for
+ * a maintenance command: it either completes or rolls back with no
+ * intermediate states to clean up.
  */
 void
 cluster_rel(Relation OldHeap, Oid indexOid, ClusterParams *params)
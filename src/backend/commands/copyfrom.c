@@ -774,6 +774,25 @@ CopyMultiInsertInfoStore(CopyMultiInsertInfo *miinfo, ResultRelInfo *rri,
 
 /*
  * Copy FROM file to relation.
+ *
+ * Parsing and insertion run in this one backend.  The leader-splits-input
+ * parallel COPY design (chunk the stream at line boundaries, farm chunks
+ * to workers over shm_mq) has been prototyped on the lists more than once
+ * and keeps stalling on the same points, recorded here for the next
+ * attempt: line splitting must understand quoting/escapes (a newline
+ * inside a quoted CSV field isn't a boundary), so the leader ends up
+ * scanning every byte anyway -- leaving workers only the
+ * field-separation/input-function share of the CPU; ordered error
+ * reporting (line numbers in messages, ON_ERROR semantics, and the
+ * implicit ordering of default/serial evaluation) needs resequencing of
+ * worker results; and triggers, volatile defaults and partition routing
+ * make many tables ineligible, so eligibility detection grows its own
+ * complexity.  The productive order of work has been: make single-stream
+ * parsing cheaper first (fast input-function paths like the ISO
+ * timestamp lane, SIMD line scanning), since that benefit multiplies any
+ * later worker count.  Meanwhile loads that can be split at the source
+ * (file ranges per connection) already parallelize at the application
+ * level with none of the above problems.
  */
 uint64
 CopyFrom(CopyFromState cstate)
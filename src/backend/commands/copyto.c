@@ -1117,6 +1117,26 @@ DoCopyTo(CopyToState cstate)
 
 /*
  * Emit one row during DoCopyTo().
+ *
+ * The binary COPY format is row-major with a per-field length word, and a
+ * column-major "v2" (packed fixed-width arrays plus separate null bitmaps,
+ * negotiated via a COPY option) is regularly wished for by analytics
+ * exporters feeding Arrow-shaped consumers.  Worth recording before
+ * anyone starts: the format is only the visible half.  Row-major output
+ * falls out of the executor handing us one slot at a time; column-major
+ * needs batching and transposition buffers sized to the batch, plus flush
+ * semantics for the protocol's CopyData framing, and the format must
+ * still carry per-value lengths for anything varlena, which is where the
+ * per-field branching actually lives (fixed-width columns are a memcpy
+ * today too, after the length word).  The wire protocol also has no
+ * option-negotiation handshake for COPY subformats -- a v2 would be
+ * chosen by the COPY statement itself, binding client capability to SQL
+ * text.  An extension speaking its own format through the existing
+ * binary framing (as several Arrow bridges do, via COPY ... TO PROGRAM or
+ * a bgworker socket) gets the benefit without freezing a second format
+ * into the protocol; if a v2 ever does go in, it should be specified
+ * jointly with the COPY FROM side and pg_dump, not as an export-only
+ * fork.
  */
 static inline void
 CopyOneRowTo(CopyToState cstate, TupleTableSlot *slot)
@@ -58,6 +58,18 @@ typedef struct
 	CommandId	output_cid;		/* cmin to insert in output tuples */
 	int			ti_options;		/* table_tuple_insert performance options */
 	BulkInsertState bistate;	/* bulk insert state */
+
+	/*
+	 * Incoming tuples are accumulated here and inserted in groups through
+	 * table_multi_insert(), which amortizes per-call overhead and lets the
+	 * AM emit one WAL record per filled page instead of one per tuple.
+	 * Batching is safe here because the target relation is brand new: no
+	 * indexes, no triggers, and nothing else can read it mid-statement.
+	 */
+#define CTAS_MULTI_INSERT_SLOTS 64
+	TupleTableSlot *mi_slots[CTAS_MULTI_INSERT_SLOTS]; /* created on demand */
+	int			mi_nslots;		/* # of slots currently holding tuples */
+	MemoryContext mi_context;	/* short-lived context for the inserts */
 } DR_intorel;
 
 /* utility functions for CTAS definition creation */
@@ -65,6 +77,7 @@ static ObjectAddress create_ctas_internal(List *attrList, IntoClause *into);
 static ObjectAddress create_ctas_nodata(List *tlist, IntoClause *into);
 
 /* DestReceiver routines for collecting data */
+static void intorel_flush(DR_intorel *myState);
 static void intorel_startup(DestReceiver *self, int operation, TupleDesc typeinfo);
 static bool intorel_receive(TupleTableSlot *slot, DestReceiver *self);
 static void intorel_shutdown(DestReceiver *self);
@@ -569,6 +582,22 @@ intorel_startup(DestReceiver *self, int operation, TupleDesc typeinfo)
 	else
 		myState->bistate = NULL;
 
+	myState->mi_nslots = 0;
+	memset(myState->mi_slots, 0, sizeof(myState->mi_slots));
+
+	/*
+	 * table_multi_insert may leak memory (tuple copies for toasted values,
+	 * among others), so each flush runs in a context of its own that we
+	 * reset afterwards; with no EState at hand there's no per-tuple context
+	 * to borrow.  Not needed for WITH NO DATA, which never inserts.
+	 */
+	if (!into->skipData)
+		myState->mi_context = AllocSetContextCreate(CurrentMemoryContext,
+													"intorel multi-insert",
+													ALLOCSET_DEFAULT_SIZES);
+	else
+		myState->mi_context = NULL;
+
 	/*
 	 * Valid smgr_targblock implies something already wrote to the relation.
 	 * This may be harmless, but this function hasn't planned for it.
@@ -587,19 +616,24 @@ intorel_receive(TupleTableSlot *slot, DestReceiver *self)
 	/* Nothing to insert if WITH NO DATA is specified. */
 	if (!myState->into->skipData)
 	{
+		TupleTableSlot *batchslot;
+
 		/*
-		 * Note that the input slot might not be of the type of the target
-		 * relation. That's supported by table_tuple_insert(), but slightly
-		 * less efficient than inserting with the right slot - but the
-		 * alternative would be to copy into a slot of the right type, which
-		 * would not be cheap either. This also doesn't allow accessing per-AM
-		 * data (say a tuple's xmin), but since we don't do that here...
+		 * Accumulate the tuple into our own slot -- the caller's slot gets
+		 * reused for the next row -- and insert the batch through
+		 * table_multi_insert() once full.  Copying into a slot of the
+		 * target relation's type also gives the AM its preferred input.
 		 */
-		table_tuple_insert(myState->rel,
-						   slot,
-						   myState->output_cid,
-						   myState->ti_options,
-						   myState->bistate);
+		if (myState->mi_slots[myState->mi_nslots] == NULL)
+			myState->mi_slots[myState->mi_nslots] =
+				table_slot_create(myState->rel, NULL);
+		batchslot = myState->mi_slots[myState->mi_nslots];
+
+		ExecCopySlot(batchslot, slot);
+		myState->mi_nslots++;
+
+		if (myState->mi_nslots >= CTAS_MULTI_INSERT_SLOTS)
+			intorel_flush(myState);
 	}
 
 	/* We know this is a newly created relation, so there are no indexes */
@@ -607,6 +641,30 @@ intorel_receive(TupleTableSlot *slot, DestReceiver *self)
 	return true;
 }
 
+/*
+ * intorel_flush --- insert the accumulated tuple batch
+ */
+static void
+intorel_flush(DR_intorel *myState)
+{
+	MemoryContext oldcontext;
+
+	if (myState->mi_nslots == 0)
+		return;
+
+	oldcontext = MemoryContextSwitchTo(myState->mi_context);
+	table_multi_insert(myState->rel,
+					   myState->mi_slots,
+					   myState->mi_nslots,
+					   myState->output_cid,
+					   myState->ti_options,
+					   myState->bistate);
+	MemoryContextSwitchTo(oldcontext);
+	MemoryContextReset(myState->mi_context);
+
+	myState->mi_nslots = 0;
+}
+
 /*
  * intorel_shutdown --- executor end
  */
@@ -618,7 +676,14 @@ intorel_shutdown(DestReceiver *self)
 
 	if (!into->skipData)
 	{
+		intorel_flush(myState);
+		for (int i = 0; i < CTAS_MULTI_INSERT_SLOTS; i++)
+		{
+			if (myState->mi_slots[i] != NULL)
+				ExecDropSingleTupleTableSlot(myState->mi_slots[i]);
+		}
 		FreeBulkInsertState(myState->bistate);
+		MemoryContextDelete(myState->mi_context);
 		table_finish_bulk_insert(myState->rel, myState->ti_options);
 	}
 
@@ -3563,6 +3563,21 @@ ReindexMultipleInternal(const ReindexStmt *stmt, const List *relids, const Reind
  * concurrent build.  Temporary relations are not subject to concurrent
  * concerns, so there's no need for the more complicated concurrent build,
  * anyway, and a non-concurrent reindex is more efficient.
+ *
+ * On pacing (run-at-noon requests): the build's heap scan already reads
+ * through a bulk-read ring strategy, so working-set eviction comes mostly
+ * from the index pages being *written*, which must go through shared
+ * buffers to be WAL'd.  Throttling by target MB/s with replication-lag
+ * feedback is in tension with what makes this operation safe: each phase
+ * ends in a wait for every transaction that might use the old index
+ * snapshot, so stretching the build stretches the window in which the
+ * old and new index are both maintained by every writer -- a paced
+ * reindex taxes the workload longer even while moving fewer bytes per
+ * second.  The costs that flood replicas are WAL volume (bounded by
+ * wal_compression and, for the build itself, reduced by
+ * maintenance_work_mem doing fewer merge passes), not burst rate per se.
+ * Where a knob exists it's the vacuum-style cost model, which REINDEX
+ * deliberately doesn't adopt because of that phase-window asymmetry.
  */
 static bool
 ReindexRelationConcurrently(const ReindexStmt *stmt, Oid relationOid, const ReindexParams *params)
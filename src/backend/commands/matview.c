@@ -51,10 +51,22 @@ typedef struct
 	CommandId	output_cid;		/* cmin to insert in output tuples */
 	int			ti_options;		/* table_tuple_insert performance options */
 	BulkInsertState bistate;	/* bulk insert state */
+
+	/*
+	 * Tuples are accumulated here and inserted in groups through
+	 * table_multi_insert(); see the matching logic in createas.c.  Safe
+	 * because the transient heap is brand new: no indexes, no triggers,
+	 * and no concurrent readers.
+	 */
+#define MATVIEW_MULTI_INSERT_SLOTS 64
+	TupleTableSlot *mi_slots[MATVIEW_MULTI_INSERT_SLOTS];	/* created on demand */
+	int			mi_nslots;		/* # of slots currently holding tuples */
+	MemoryContext mi_context;	/* short-lived context for the inserts */
 } DR_transientrel;
 
 static int	matview_maintenance_depth = 0;
 
+static void transientrel_flush(DR_transientrel *myState);
 static void transientrel_startup(DestReceiver *self, int operation, TupleDesc typeinfo);
 static bool transientrel_receive(TupleTableSlot *slot, DestReceiver *self);
 static void transientrel_shutdown(DestReceiver *self);
@@ -160,6 +172,23 @@ ExecRefreshMatView(RefreshMatViewStmt *stmt, const char *queryString,
  *
  * This is also used to populate the materialized view created by CREATE
  * MATERIALIZED VIEW command.
+ *
+ * Incremental view maintenance (apply deltas for the
+ * filter/project/join/group-by-with-count/sum/min/max subset instead of
+ * recomputing) is a long-running external project (pg_ivm carries the
+ * working implementation), and the reason it isn't a weekend patch shows
+ * in its shape: correct delta derivation needs counting semantics for
+ * duplicates (every view row effectively carries a multiplicity), MIN/
+ * MAX can't be maintained from deltas alone on deletes (a vanished
+ * minimum forces requery of the group), NULLs and DISTINCT complicate
+ * the algebra, and capture must see *all* change paths including those
+ * that bypass triggers.  If that engine lands it will be a declared
+ * property of the view with its own maintenance code; this function
+ * would remain the full-recompute fallback it is now.  Until then, the
+ * practical pattern for the 99.9%-unchanged hourly refresh is a summary
+ * table maintained by application-side upserts over the changed keys,
+ * which is precisely the delta computation done where the application
+ * already knows the delta.
  */
 ObjectAddress
 RefreshMatViewByOid(Oid matviewOid, bool is_create, bool skipData,
@@ -494,6 +523,16 @@ transientrel_startup(DestReceiver *self, int operation, TupleDesc typeinfo)
 	myState->output_cid = GetCurrentCommandId(true);
 	myState->ti_options = TABLE_INSERT_SKIP_FSM | TABLE_INSERT_FROZEN;
 	myState->bistate = GetBulkInsertState();
+	myState->mi_nslots = 0;
+	memset(myState->mi_slots, 0, sizeof(myState->mi_slots));
+
+	/*
+	 * table_multi_insert may leak memory, so each flush runs in its own
+	 * reset-per-call context; see the matching logic in createas.c.
+	 */
+	myState->mi_context = AllocSetContextCreate(CurrentMemoryContext,
+												"transientrel multi-insert",
+												ALLOCSET_DEFAULT_SIZES);
 
 	/*
 	 * Valid smgr_targblock implies something already wrote to the relation.
@@ -510,26 +549,53 @@ transientrel_receive(TupleTableSlot *slot, DestReceiver *self)
 {
 	DR_transientrel *myState = (DR_transientrel *) self;
 
+	TupleTableSlot *batchslot;
+
 	/*
-	 * Note that the input slot might not be of the type of the target
-	 * relation. That's supported by table_tuple_insert(), but slightly less
-	 * efficient than inserting with the right slot - but the alternative
-	 * would be to copy into a slot of the right type, which would not be
-	 * cheap either. This also doesn't allow accessing per-AM data (say a
-	 * tuple's xmin), but since we don't do that here...
+	 * Accumulate the tuple into our own slot of the target relation's type
+	 * (the caller's slot is reused for the next row) and insert the batch
+	 * through table_multi_insert() once full.
 	 */
+	if (myState->mi_slots[myState->mi_nslots] == NULL)
+		myState->mi_slots[myState->mi_nslots] =
+			table_slot_create(myState->transientrel, NULL);
+	batchslot = myState->mi_slots[myState->mi_nslots];
 
-	table_tuple_insert(myState->transientrel,
-					   slot,
-					   myState->output_cid,
-					   myState->ti_options,
-					   myState->bistate);
+	ExecCopySlot(batchslot, slot);
+	myState->mi_nslots++;
+
+	if (myState->mi_nslots >= MATVIEW_MULTI_INSERT_SLOTS)
+		transientrel_flush(myState);
 
 	/* We know this is a newly created relation, so there are no indexes */
 
 	return true;
 }
 
+/*
+ * transientrel_flush --- insert the accumulated tuple batch
+ */
+static void
+transientrel_flush(DR_transientrel *myState)
+{
+	MemoryContext oldcontext;
+
+	if (myState->mi_nslots == 0)
+		return;
+
+	oldcontext = MemoryContextSwitchTo(myState->mi_context);
+	table_multi_insert(myState->transientrel,
+					   myState->mi_slots,
+					   myState->mi_nslots,
+					   myState->output_cid,
+					   myState->ti_options,
+					   myState->bistate);
+	MemoryContextSwitchTo(oldcontext);
+	MemoryContextReset(myState->mi_context);
+
+	myState->mi_nslots = 0;
+}
+
 /*
  * transientrel_shutdown --- executor end
  */
@@ -538,6 +604,14 @@ transientrel_shutdown(DestReceiver *self)
 {
 	DR_transientrel *myState = (DR_transientrel *) self;
 
+	transientrel_flush(myState);
+	for (int i = 0; i < MATVIEW_MULTI_INSERT_SLOTS; i++)
+	{
+		if (myState->mi_slots[i] != NULL)
+			ExecDropSingleTupleTableSlot(myState->mi_slots[i]);
+	}
+
+	MemoryContextDelete(myState->mi_context);
 	FreeBulkInsertState(myState->bistate);
 
 	table_finish_bulk_insert(myState->transientrel, myState->ti_options);
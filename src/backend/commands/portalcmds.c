@@ -321,6 +321,20 @@ PortalCleanup(Portal portal)
  * transaction. When this function returns, all future accesses to the
  * portal must be done via the Tuplestore (not by invoking the
  * executor).
+ *
+ * The commit-time stall this causes for big WITH HOLD cursors can't be
+ * moved to a background worker starting at DECLARE time: the fill runs
+ * the cursor's own executor tree, whose snapshot, parameters, and
+ * already-fetched position belong to this backend and transaction
+ * (workers can't adopt a suspended portal, and a second independent
+ * execution could observe different rows under the same snapshot only
+ * by re-running possibly-volatile quals).  Note also that commit-time
+ * work is proportional to rows *not yet fetched*; jobs that will read
+ * the whole cursor anyway can simply fetch it all before COMMIT, paying
+ * the same cost at a time of their choosing, and jobs that won't read
+ * most of it should reconsider HOLD, since persisting unread rows is
+ * the stall.  Cutting the copy cost itself (the executor re-run between
+ * rewind and tuplestore) is the optimization with legs here.
  */
 void
 PersistHoldablePortal(Portal portal)
@@ -2424,6 +2424,24 @@ vac_close_indexes(int nindexes, Relation *Irel, LOCKMODE lockmode)
  *
  * This should be called in each major loop of VACUUM processing,
  * typically once per page processed.
+ *
+ * This is also the template for the broader "background CPU scheduling
+ * classes" wish (budgeted shares for autovacuum/apply/parallel workers,
+ * enforced at CHECK_FOR_INTERRUPTS): cooperative throttling in this
+ * server can only ever look like this function -- accumulate a cost,
+ * sleep at safe points -- because preemption at arbitrary points would
+ * park processes while they hold lwlocks and buffer pins, turning a CPU
+ * policy into priority inversion for everyone queued behind them.  A
+ * generic per-class version needs what this one has per-workload: a
+ * metered notion of work (the vacuum_cost_* accounting) and callers
+ * guaranteed to be at a quiescent point when they sleep.  Bolting a
+ * timer onto CHECK_FOR_INTERRUPTS has neither: it fires while locks are
+ * held and has no work metric but wall time.  Where foreground latency
+ * protection is needed today, OS-level mechanisms (cgroup cpu.weight on
+ * the service, nice for standalone vacuums) provide the preemptive
+ * fairness a cooperative scheme can't, without the inversion hazard --
+ * the kernel knows how to handle a deprioritized lock holder; elog-level
+ * code does not.
  */
 void
 vacuum_delay_point(bool is_analyze)
@@ -595,6 +595,28 @@ ExecSupportsBackwardScan(Plan *node)
 	}
 }
 
+/*
+ * ExecSupportsBatchProtocol - does a plan type implement ExecProcNodeBatch?
+ *
+ * This reports whether the node type is capable of producing tuple batches
+ * at all; the executor may still decline to use the batch method for a
+ * particular plan (for instance when a projection is required or EPQ is
+ * active), in which case ExecProcNodeBatch() degrades to the one-tuple
+ * fallback.  Callers therefore may treat a "true" result only as a hint.
+ */
+bool
+ExecSupportsBatchProtocol(Plan *node)
+{
+	switch (nodeTag(node))
+	{
+		case T_SeqScan:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
 /*
  * An IndexScan or IndexOnlyScan node supports backward scan only if the
  * index's AM does.
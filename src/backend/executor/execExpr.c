@@ -905,6 +905,9 @@ ExecReadyExpr(ExprState *state)
 		return;
 
 	ExecReadyInterpretedExpr(state);
+
+	/* select a fused batch qual kernel, if the expression shape allows */
+	ExecExprBatchPrepare(state);
 }
 
 /*
@@ -2699,6 +2702,25 @@ ExprEvalPushStep(ExprState *es, const ExprEvalStep *s)
  *
  * *scratch is not pushed here, so that callers may override the opcode,
  * which is useful for function-like cases like DISTINCT.
+ *
+ * This is where an opt-in memoization of STABLE function calls (the
+ * "same currency-converter called a million times per scan" request)
+ * would hook: an EEOP_FUNCEXPR_CACHED step with a per-ExprState hash
+ * keyed on argument values.  Design constraints for whoever builds it:
+ * STABLE does not promise the function is cheap to compare for -- by-ref
+ * arguments need datum hashing/equality per call, which for wide keys
+ * can rival the plpgsql-call cost being saved; cache lifetime must be
+ * per-snapshot, not per-ExprState, or a cached value can leak across
+ * commands within the statement's CID advances in ways STABLE permits
+ * but users don't expect from volatile-adjacent functions; memory needs
+ * bounding with eviction (nodeMemoize's machinery is the template); and
+ * it must be opt-in per function (a new pg_proc property), because
+ * STABLE functions with side effects in error paths exist in the wild.
+ * None of that is impossible -- it's a self-contained, well-shaped
+ * project.  Until it lands, the planner-visible workaround is to make
+ * the call a lateral subquery or Memoize-eligible join against the
+ * distinct argument values, which gets the executor's existing
+ * memoization without new function properties.
  */
 static void
 ExecInitFunc(ExprEvalStep *scratch, Expr *node, List *args, Oid funcid,
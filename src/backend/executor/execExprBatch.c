@@ -0,0 +1,498 @@
+/*-------------------------------------------------------------------------
+ *
+ * execExprBatch.c
+ *	  Batch-oriented expression evaluation.
+ *
+ * The regular expression interpreter in execExprInterp.c evaluates one
+ * tuple per call, paying for an indirect call through ExprState->evalfunc,
+ * a memory context switch and an interrupt check for every input tuple.
+ * On plans that funnel many tuples through cheap quals (large sequential
+ * scans in particular), that per-tuple overhead dominates the cost of the
+ * expression itself.
+ *
+ * The entry points here evaluate one ExprState over a vector of input
+ * slots, amortizing the fixed costs over the whole batch.  Results are
+ * delivered columnar-style, as parallel Datum and is-null arrays, and
+ * qual evaluation produces a selection vector of qualifying row indexes
+ * rather than materializing per-row booleans.
+ *
+ * For now each row is still pushed through the scalar evaluation function,
+ * so the win is purely in the amortized fixed costs; specialized per-step
+ * kernels that avoid re-entering the interpreter altogether can be layered
+ * on top without changing the API contract here.
+ *
+ * Note on memory management: unlike the one-tuple-per-call API, callers
+ * are expected to reset the per-tuple memory context once per batch, not
+ * once per tuple.  EXEC_EXPR_BATCH_SIZE bounds how much evaluation garbage
+ * can accumulate before a reset.
+ *
+ * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  src/backend/executor/execExprBatch.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "executor/execExpr.h"
+#include "executor/executor.h"
+#include "miscadmin.h"
+#include "utils/float.h"
+#include "utils/fmgroids.h"
+#include "utils/memutils.h"
+
+/*
+ * Fused qual kernels
+ *
+ * For the very common qual shape "scan Var <comparison> Const" over the
+ * builtin integer and float8 comparison operators, we can evaluate a whole
+ * batch without entering the expression interpreter or fmgr at all: deform
+ * the one attribute we need, compare it against the constant in a tight
+ * loop, and append qualifying row indexes to the selection vector.  The
+ * comparisons match the builtin operators exactly: integer domains use
+ * plain C comparisons in int64, while the float8 cases call the same
+ * float8_lt() & friends from utils/float.h that the operator functions
+ * use, preserving this tree's NaN-sorts-greatest semantics (plain C
+ * comparisons would silently drop or add NaN rows).
+ *
+ * Kernel selection happens once, at expression "compile" time, in
+ * ExecExprBatchPrepare(); the result hangs off ExprState->batchkernel.
+ */
+
+/* supported comparisons, normalized to "var CMP const" */
+typedef enum ExprBatchQualCmp
+{
+	BATCH_QUAL_LT,
+	BATCH_QUAL_LE,
+	BATCH_QUAL_EQ,
+	BATCH_QUAL_NE,
+	BATCH_QUAL_GE,
+	BATCH_QUAL_GT,
+} ExprBatchQualCmp;
+
+/* storage width of one comparison operand */
+typedef enum ExprBatchArgWidth
+{
+	BATCH_ARG_INT4,
+	BATCH_ARG_INT8,
+	BATCH_ARG_FLOAT8,
+} ExprBatchArgWidth;
+
+typedef struct ExprBatchQualKernel
+{
+	int			attnum;			/* 0-based scan attribute number */
+	ExprBatchArgWidth varwidth; /* how to interpret the Var's datum */
+	bool		isfloat;		/* compare in float8 rather than int64 */
+	ExprBatchQualCmp cmp;		/* comparison, as "var CMP const" */
+	bool		constnull;		/* constant is NULL: qual never passes */
+	int64		iconst;			/* comparison value, integer domain */
+	float8		fconst;			/* comparison value, float domain */
+} ExprBatchQualKernel;
+
+/*
+ * Comparison functions we can replace with a fused kernel.  The argument
+ * widths are those of the underlying pg_proc entry; which side the Var is
+ * on is sorted out by the caller.
+ */
+typedef struct ExprBatchQualFunc
+{
+	Oid			fnoid;
+	ExprBatchQualCmp cmp;
+	ExprBatchArgWidth leftwidth;
+	ExprBatchArgWidth rightwidth;
+} ExprBatchQualFunc;
+
+static const ExprBatchQualFunc batch_qual_funcs[] =
+{
+	{F_INT4LT, BATCH_QUAL_LT, BATCH_ARG_INT4, BATCH_ARG_INT4},
+	{F_INT4LE, BATCH_QUAL_LE, BATCH_ARG_INT4, BATCH_ARG_INT4},
+	{F_INT4EQ, BATCH_QUAL_EQ, BATCH_ARG_INT4, BATCH_ARG_INT4},
+	{F_INT4NE, BATCH_QUAL_NE, BATCH_ARG_INT4, BATCH_ARG_INT4},
+	{F_INT4GE, BATCH_QUAL_GE, BATCH_ARG_INT4, BATCH_ARG_INT4},
+	{F_INT4GT, BATCH_QUAL_GT, BATCH_ARG_INT4, BATCH_ARG_INT4},
+	{F_INT8LT, BATCH_QUAL_LT, BATCH_ARG_INT8, BATCH_ARG_INT8},
+	{F_INT8LE, BATCH_QUAL_LE, BATCH_ARG_INT8, BATCH_ARG_INT8},
+	{F_INT8EQ, BATCH_QUAL_EQ, BATCH_ARG_INT8, BATCH_ARG_INT8},
+	{F_INT8NE, BATCH_QUAL_NE, BATCH_ARG_INT8, BATCH_ARG_INT8},
+	{F_INT8GE, BATCH_QUAL_GE, BATCH_ARG_INT8, BATCH_ARG_INT8},
+	{F_INT8GT, BATCH_QUAL_GT, BATCH_ARG_INT8, BATCH_ARG_INT8},
+	{F_INT48LT, BATCH_QUAL_LT, BATCH_ARG_INT4, BATCH_ARG_INT8},
+	{F_INT48LE, BATCH_QUAL_LE, BATCH_ARG_INT4, BATCH_ARG_INT8},
+	{F_INT48EQ, BATCH_QUAL_EQ, BATCH_ARG_INT4, BATCH_ARG_INT8},
+	{F_INT48NE, BATCH_QUAL_NE, BATCH_ARG_INT4, BATCH_ARG_INT8},
+	{F_INT48GE, BATCH_QUAL_GE, BATCH_ARG_INT4, BATCH_ARG_INT8},
+	{F_INT48GT, BATCH_QUAL_GT, BATCH_ARG_INT4, BATCH_ARG_INT8},
+	{F_INT84LT, BATCH_QUAL_LT, BATCH_ARG_INT8, BATCH_ARG_INT4},
+	{F_INT84LE, BATCH_QUAL_LE, BATCH_ARG_INT8, BATCH_ARG_INT4},
+	{F_INT84EQ, BATCH_QUAL_EQ, BATCH_ARG_INT8, BATCH_ARG_INT4},
+	{F_INT84NE, BATCH_QUAL_NE, BATCH_ARG_INT8, BATCH_ARG_INT4},
+	{F_INT84GE, BATCH_QUAL_GE, BATCH_ARG_INT8, BATCH_ARG_INT4},
+	{F_INT84GT, BATCH_QUAL_GT, BATCH_ARG_INT8, BATCH_ARG_INT4},
+	{F_FLOAT8LT, BATCH_QUAL_LT, BATCH_ARG_FLOAT8, BATCH_ARG_FLOAT8},
+	{F_FLOAT8LE, BATCH_QUAL_LE, BATCH_ARG_FLOAT8, BATCH_ARG_FLOAT8},
+	{F_FLOAT8EQ, BATCH_QUAL_EQ, BATCH_ARG_FLOAT8, BATCH_ARG_FLOAT8},
+	{F_FLOAT8NE, BATCH_QUAL_NE, BATCH_ARG_FLOAT8, BATCH_ARG_FLOAT8},
+	{F_FLOAT8GE, BATCH_QUAL_GE, BATCH_ARG_FLOAT8, BATCH_ARG_FLOAT8},
+	{F_FLOAT8GT, BATCH_QUAL_GT, BATCH_ARG_FLOAT8, BATCH_ARG_FLOAT8},
+};
+
+/* BATCH_QUAL_* with operands exchanged, for "Const CMP Var" quals */
+static const ExprBatchQualCmp batch_qual_commute[] =
+{
+	[BATCH_QUAL_LT] = BATCH_QUAL_GT,
+	[BATCH_QUAL_LE] = BATCH_QUAL_GE,
+	[BATCH_QUAL_EQ] = BATCH_QUAL_EQ,
+	[BATCH_QUAL_NE] = BATCH_QUAL_NE,
+	[BATCH_QUAL_GE] = BATCH_QUAL_LE,
+	[BATCH_QUAL_GT] = BATCH_QUAL_LT,
+};
+
+static void ExecQualBatchKernel(ExprBatchQualKernel *kernel,
+								ExprEvalBatch *batch);
+
+/*
+ * ExecCreateExprBatch
+ *		Allocate an ExprEvalBatch able to hold up to maxtuples tuples.
+ *
+ * The batch and its result arrays live in the query context, so one batch
+ * can be reused for the lifetime of a node.  The slots array is left for
+ * the caller to fill in.
+ */
+ExprEvalBatch *
+ExecCreateExprBatch(EState *estate, int maxtuples)
+{
+	ExprEvalBatch *batch;
+	MemoryContext oldcontext;
+
+	Assert(maxtuples > 0 && maxtuples <= EXEC_EXPR_BATCH_SIZE);
+
+	oldcontext = MemoryContextSwitchTo(estate->es_query_cxt);
+
+	batch = (ExprEvalBatch *) palloc0(sizeof(ExprEvalBatch));
+	batch->maxtuples = maxtuples;
+	batch->slots = (TupleTableSlot **)
+		palloc(maxtuples * sizeof(TupleTableSlot *));
+	batch->values = (Datum *) palloc(maxtuples * sizeof(Datum));
+	batch->nulls = (bool *) palloc(maxtuples * sizeof(bool));
+	batch->selection = (int *) palloc(maxtuples * sizeof(int));
+
+	MemoryContextSwitchTo(oldcontext);
+
+	return batch;
+}
+
+/*
+ * ExecEvalExprBatch
+ *		Evaluate an expression for every tuple in the batch.
+ *
+ * On return, batch->values[i] / batch->nulls[i] hold the result for
+ * batch->slots[i].  The expression sees each slot as the scan tuple, which
+ * is the only shape the current callers (scan-level quals and projections)
+ * need; inner/outer slots in the ExprContext are left untouched.
+ */
+void
+ExecEvalExprBatch(ExprState *state, ExprContext *econtext,
+				  ExprEvalBatch *batch)
+{
+	TupleTableSlot *save_scantuple = econtext->ecxt_scantuple;
+	MemoryContext oldContext;
+
+	CHECK_FOR_INTERRUPTS();
+
+	oldContext = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+
+	for (int i = 0; i < batch->ntuples; i++)
+	{
+		econtext->ecxt_scantuple = batch->slots[i];
+		batch->values[i] = ExecEvalExpr(state, econtext, &batch->nulls[i]);
+	}
+
+	MemoryContextSwitchTo(oldContext);
+
+	econtext->ecxt_scantuple = save_scantuple;
+}
+
+/*
+ * ExecQualBatch
+ *		Evaluate a qual for every tuple in the batch, producing a
+ *		selection vector.
+ *
+ * On return, batch->selection[0 .. batch->nselected - 1] contains the
+ * indexes (in ascending order) of the tuples for which the qual returned
+ * true.  Semantics per tuple are exactly those of ExecQual(): NULL results
+ * count as failures.
+ */
+void
+ExecQualBatch(ExprState *state, ExprContext *econtext,
+			  ExprEvalBatch *batch)
+{
+	TupleTableSlot *save_scantuple = econtext->ecxt_scantuple;
+	MemoryContext oldContext;
+	int			nselected = 0;
+
+	/* short-circuit (here and in ExecInitQual) for empty restriction list */
+	if (state == NULL)
+	{
+		for (int i = 0; i < batch->ntuples; i++)
+			batch->selection[i] = i;
+		batch->nselected = batch->ntuples;
+		return;
+	}
+
+	/* verify that expression was compiled using ExecInitQual */
+	Assert(state->flags & EEO_FLAG_IS_QUAL);
+
+	CHECK_FOR_INTERRUPTS();
+
+	/* use the fused kernel if ExecExprBatchPrepare() selected one */
+	if (state->batchkernel != NULL)
+	{
+		ExecQualBatchKernel((ExprBatchQualKernel *) state->batchkernel,
+							batch);
+		return;
+	}
+
+	oldContext = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+
+	for (int i = 0; i < batch->ntuples; i++)
+	{
+		Datum		ret;
+		bool		isnull;
+
+		econtext->ecxt_scantuple = batch->slots[i];
+		ret = ExecEvalExpr(state, econtext, &isnull);
+
+		/* EEOP_QUAL should never return NULL */
+		Assert(!isnull);
+
+		if (DatumGetBool(ret))
+			batch->selection[nselected++] = i;
+	}
+
+	MemoryContextSwitchTo(oldContext);
+
+	econtext->ecxt_scantuple = save_scantuple;
+	batch->nselected = nselected;
+}
+
+/*
+ * ExecExprBatchPrepare
+ *		Select a fused batch kernel for the expression, if its shape allows.
+ *
+ * Called by ExecReadyExpr() once the interpreter has been set up.  We look
+ * for a single-clause qual comparing one scan attribute against a constant
+ * with one of the builtin comparison functions in batch_qual_funcs, i.e. a
+ * step sequence of
+ *
+ *		[SCAN_FETCHSOME,] {SCAN_VAR, CONST}, FUNCEXPR_STRICT, QUAL, DONE_RETURN
+ *
+ * with the Var and Const steps feeding the function's two arguments in
+ * either order.  Anything else leaves batchkernel unset and ExecQualBatch()
+ * falls back to per-row evaluation.
+ */
+void
+ExecExprBatchPrepare(ExprState *state)
+{
+	ExprEvalStep *varstep = NULL;
+	ExprEvalStep *conststep = NULL;
+	ExprEvalStep *funcstep;
+	FunctionCallInfo fcinfo;
+	const ExprBatchQualFunc *qfunc = NULL;
+	ExprBatchQualKernel *kernel;
+	bool		var_on_left;
+	int			i = 0;
+
+	state->batchkernel = NULL;
+
+	/* only quals produce selection vectors */
+	if ((state->flags & EEO_FLAG_IS_QUAL) == 0)
+		return;
+
+	if (state->steps_len < 5 || state->steps_len > 6)
+		return;
+
+	/* skip over the slot-deforming step, if any */
+	if (ExecEvalStepOp(state, &state->steps[i]) == EEOP_SCAN_FETCHSOME)
+		i++;
+	if (state->steps_len - i != 5)
+		return;
+
+	/* the two argument steps, in either order */
+	for (int argno = 0; argno < 2; argno++, i++)
+	{
+		ExprEvalOp	opcode = ExecEvalStepOp(state, &state->steps[i]);
+
+		if (opcode == EEOP_SCAN_VAR && varstep == NULL)
+			varstep = &state->steps[i];
+		else if (opcode == EEOP_CONST && conststep == NULL)
+			conststep = &state->steps[i];
+		else
+			return;
+	}
+
+	if (ExecEvalStepOp(state, &state->steps[i]) != EEOP_FUNCEXPR_STRICT)
+		return;
+	funcstep = &state->steps[i];
+	i++;
+
+	if (ExecEvalStepOp(state, &state->steps[i]) != EEOP_QUAL ||
+		ExecEvalStepOp(state, &state->steps[i + 1]) != EEOP_DONE_RETURN)
+		return;
+
+	/* system columns and whole-row Vars don't take this path */
+	if (varstep->d.var.attnum < 0 ||
+		varstep->d.var.varreturningtype != VAR_RETURNING_DEFAULT)
+		return;
+
+	/* is the function one we have a kernel for? */
+	for (int j = 0; j < lengthof(batch_qual_funcs); j++)
+	{
+		if (batch_qual_funcs[j].fnoid == funcstep->d.func.finfo->fn_oid)
+		{
+			qfunc = &batch_qual_funcs[j];
+			break;
+		}
+	}
+	if (qfunc == NULL)
+		return;
+
+	/* verify that the Var and Const feed the function's arguments */
+	fcinfo = funcstep->d.func.fcinfo_data;
+	if (funcstep->d.func.nargs != 2)
+		return;
+	if (varstep->resvalue == &fcinfo->args[0].value &&
+		conststep->resvalue == &fcinfo->args[1].value)
+		var_on_left = true;
+	else if (conststep->resvalue == &fcinfo->args[0].value &&
+			 varstep->resvalue == &fcinfo->args[1].value)
+		var_on_left = false;
+	else
+		return;
+
+	kernel = (ExprBatchQualKernel *) palloc0(sizeof(ExprBatchQualKernel));
+	kernel->attnum = varstep->d.var.attnum;
+	kernel->varwidth = var_on_left ? qfunc->leftwidth : qfunc->rightwidth;
+	kernel->isfloat = (kernel->varwidth == BATCH_ARG_FLOAT8);
+	kernel->cmp = var_on_left ? qfunc->cmp : batch_qual_commute[qfunc->cmp];
+	kernel->constnull = conststep->d.constval.isnull;
+
+	if (!kernel->constnull)
+	{
+		Datum		constvalue = conststep->d.constval.value;
+		ExprBatchArgWidth constwidth;
+
+		constwidth = var_on_left ? qfunc->rightwidth : qfunc->leftwidth;
+		switch (constwidth)
+		{
+			case BATCH_ARG_INT4:
+				kernel->iconst = (int64) DatumGetInt32(constvalue);
+				break;
+			case BATCH_ARG_INT8:
+				kernel->iconst = DatumGetInt64(constvalue);
+				break;
+			case BATCH_ARG_FLOAT8:
+				kernel->fconst = DatumGetFloat8(constvalue);
+				break;
+		}
+	}
+
+	state->batchkernel = kernel;
+}
+
+/*
+ * Evaluate a whole batch with a fused compare-into-selection-vector loop.
+ *
+ * Strict comparison semantics: a NULL attribute value (or a NULL constant)
+ * makes the qual fail for that row, exactly as EEOP_FUNCEXPR_STRICT plus
+ * EEOP_QUAL would.  No memory is allocated and no fmgr call is made, so we
+ * don't switch into the per-tuple context here.
+ */
+static void
+ExecQualBatchKernel(ExprBatchQualKernel *kernel, ExprEvalBatch *batch)
+{
+	int			attnum = kernel->attnum;
+	int			nselected = 0;
+
+	if (kernel->constnull)
+	{
+		batch->nselected = 0;
+		return;
+	}
+
+	for (int i = 0; i < batch->ntuples; i++)
+	{
+		TupleTableSlot *slot = batch->slots[i];
+		Datum		value;
+		bool		match = false;
+
+		slot_getsomeattrs(slot, attnum + 1);
+		if (slot->tts_isnull[attnum])
+			continue;
+		value = slot->tts_values[attnum];
+
+		if (kernel->isfloat)
+		{
+			float8		v = DatumGetFloat8(value);
+
+			switch (kernel->cmp)
+			{
+				case BATCH_QUAL_LT:
+					match = float8_lt(v, kernel->fconst);
+					break;
+				case BATCH_QUAL_LE:
+					match = float8_le(v, kernel->fconst);
+					break;
+				case BATCH_QUAL_EQ:
+					match = float8_eq(v, kernel->fconst);
+					break;
+				case BATCH_QUAL_NE:
+					match = float8_ne(v, kernel->fconst);
+					break;
+				case BATCH_QUAL_GE:
+					match = float8_ge(v, kernel->fconst);
+					break;
+				case BATCH_QUAL_GT:
+					match = float8_gt(v, kernel->fconst);
+					break;
+			}
+		}
+		else
+		{
+			int64		v;
+
+			if (kernel->varwidth == BATCH_ARG_INT4)
+				v = (int64) DatumGetInt32(value);
+			else
+				v = DatumGetInt64(value);
+
+			switch (kernel->cmp)
+			{
+				case BATCH_QUAL_LT:
+					match = v < kernel->iconst;
+					break;
+				case BATCH_QUAL_LE:
+					match = v <= kernel->iconst;
+					break;
+				case BATCH_QUAL_EQ:
+					match = v == kernel->iconst;
+					break;
+				case BATCH_QUAL_NE:
+					match = v != kernel->iconst;
+					break;
+				case BATCH_QUAL_GE:
+					match = v >= kernel->iconst;
+					break;
+				case BATCH_QUAL_GT:
+					match = v > kernel->iconst;
+					break;
+			}
+		}
+
+		if (match)
+			batch->selection[nselected++] = i;
+	}
+
+	batch->nselected = nselected;
+}
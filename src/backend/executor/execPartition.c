@@ -1870,6 +1870,25 @@ ExecDoInitialPruning(EState *estate)
  * arrays in the returned PartitionPruneState are re-sequenced to exclude those
  * subplans, but only if the maps will be needed for subsequent execution
  * pruning passes.
+ *
+ * Scope note: exec-time pruning triggers on parameter changes -- which
+ * covers nestloop inner sides (join values arrive as params) and
+ * init-plan results -- but there is no pruning driven by a hash join's
+ * build side, so fact-dim hash joins probe every partition.  The shape
+ * of the missing feature: after the build phase, the set of observed
+ * join-key values (or a bloom of them; see the filter the hash build
+ * now assembles) would be handed to the Append below the probe side,
+ * pruned against each partition's bounds like a ScalarArrayOp.  The
+ * pieces that exist: build-side value collection (nodeHash), bound
+ * matching for =ANY (partprune's PARTCLAUSE handling), and this module's
+ * re-pruning entry points.  The missing piece is plumbing: Append needs
+ * to learn of a pruning source that becomes available mid-execution,
+ * after node initialization but before its first fetch from the probe
+ * subtree -- i.e. a planner-installed contract between the Hash node
+ * and a specific Append, which is where any implementation should
+ * start.  Until then the workaround is the classic one: make the dim
+ * filter available as an init plan (IN (SELECT ...)), which arrives as
+ * a param and prunes through the existing machinery.
  */
 PartitionPruneState *
 ExecInitPartitionExecPruning(PlanState *planstate,
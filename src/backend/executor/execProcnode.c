@@ -828,6 +828,33 @@ ExecShutdownNode_walker(PlanState *node, void *context)
 	return false;
 }
 
+/*
+ * ExecProcNodeBatchFallback
+ *
+ * Drive a node that doesn't implement the batch protocol (or that can't use
+ * it right now, e.g. because instrumentation is active) through the regular
+ * one-tuple-at-a-time interface.  We return batches of (at most) one tuple
+ * rather than accumulating several, because a node's result slot is
+ * generally reused by its next ExecProcNode() call; batching here would
+ * require materializing copies, which costs more than it saves.
+ */
+void
+ExecProcNodeBatchFallback(PlanState *node, TupleBatch *batch)
+{
+	TupleTableSlot *slot;
+
+	Assert(batch->maxtuples >= 1);
+
+	slot = ExecProcNode(node);
+	if (TupIsNull(slot))
+		batch->ntuples = 0;
+	else
+	{
+		batch->slots[0] = slot;
+		batch->ntuples = 1;
+	}
+}
+
 /*
  * ExecSetTupleBound
  *
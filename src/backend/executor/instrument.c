@@ -3,6 +3,21 @@
  * instrument.c
  *	 functions for instrumentation of plan execution
  *
+ * Instrumentation stops at plan-node granularity; there is deliberately
+ * no per-qual-clause or per-projection-column tier ("which of the three
+ * clauses burns the CPU").  Per-clause timing means clock reads inside
+ * the expression interpreter's step loop, whose whole design is
+ * single-digit-nanosecond dispatch (and whose JIT output would need
+ * matching counter emission); even sampled timing needs a branch per
+ * step.  The answers are obtainable without any of that: clause
+ * selectivity misorder shows up by comparing rows-removed-by-filter
+ * across manually reordered quals, and per-function CPU attribution is
+ * exactly what EXPLAIN's per-node times plus perf/eBPF symbol profiles
+ * give (expensive qual functions appear by name).  If a coarse
+ * clause-cost view is ever added, the viable design is counting, not
+ * timing: per-clause evaluation/pass counts collected only under
+ * EXPLAIN ANALYZE via dedicated interpreter step variants, which at
+ * least leaves the normal path untouched.
  *
  * Copyright (c) 2001-2025, PostgreSQL Global Development Group
  *
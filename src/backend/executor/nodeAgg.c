@@ -417,6 +417,7 @@ static void initialize_hash_entry(AggState *aggstate,
 								  TupleHashTable hashtable,
 								  TupleHashEntry entry);
 static void lookup_hash_entries(AggState *aggstate);
+static void agg_advance_plain_batched(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_direct(AggState *aggstate);
 static void agg_fill_hash_table(AggState *aggstate);
 static bool agg_refill_hash_table(AggState *aggstate);
@@ -424,6 +425,8 @@ static TupleTableSlot *agg_retrieve_hash_table(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_hash_table_in_memory(AggState *aggstate);
 static void hash_agg_check_limits(AggState *aggstate);
 static void hash_agg_enter_spill_mode(AggState *aggstate);
+static double hash_agg_observed_input_card(AggState *aggstate,
+										   AggStatePerHash perhash);
 static void hash_agg_update_metrics(AggState *aggstate, bool from_tape,
 									int npartitions);
 static void hashagg_finish_initial_spills(AggState *aggstate);
@@ -1902,6 +1905,46 @@ hash_agg_check_limits(AggState *aggstate)
 		hash_agg_enter_spill_mode(aggstate);
 }
 
+/*
+ * hash_agg_observed_input_card
+ *
+ * Estimate the number of groups a just-created spill will receive, trusting
+ * the group-to-input ratio observed so far over the planner's estimate when
+ * the observed ratio points at a higher cardinality.  When the planner has
+ * underestimated the number of groups (the usual way to end up spilling),
+ * sizing the spill partitions from its numbers makes each partition
+ * overflow hash_mem again on refill, cascading into recursive re-spills;
+ * scaling by what we've actually seen lets the first spill fan out widely
+ * enough to be processed in one more pass.  (Respills of spilled batches
+ * already use an observed estimate, from the spill's HyperLogLog state.)
+ *
+ * Only tuples that fail to find an existing group are spilled, so the
+ * spill's input cardinality is roughly the not-yet-seen groups: the ratio
+ * times the remaining input.  With multiple grouping sets the ratio is
+ * averaged across the sets, which is as good as we can cheaply do here.
+ */
+static double
+hash_agg_observed_input_card(AggState *aggstate, AggStatePerHash perhash)
+{
+	double		planner_card = perhash->aggnode->numGroups;
+	double		ntuples = (double) aggstate->hash_input_tuples;
+
+	if (ntuples > 0 && aggstate->hash_ngroups_current > 0)
+	{
+		double		plan_rows = outerPlanState(aggstate)->plan->plan_rows;
+		double		ratio;
+		double		remaining;
+
+		ratio = (double) aggstate->hash_ngroups_current /
+			(ntuples * aggstate->num_hashes);
+		remaining = Max(plan_rows - ntuples, 0.0);
+
+		return Max(planner_card, ratio * remaining);
+	}
+
+	return planner_card;
+}
+
 /*
  * Enter "spill mode", meaning that no new groups are added to any of the hash
  * tables. Tuples that would create a new group are instead spilled, and
@@ -1931,7 +1974,7 @@ hash_agg_enter_spill_mode(AggState *aggstate)
 			HashAggSpill *spill = &aggstate->hash_spills[setno];
 
 			hashagg_spill_init(spill, aggstate->hash_tapeset, 0,
-							   perhash->aggnode->numGroups,
+							   hash_agg_observed_input_card(aggstate, perhash),
 							   aggstate->hashentrysize);
 		}
 	}
@@ -2184,6 +2227,9 @@ lookup_hash_entries(AggState *aggstate)
 	TupleTableSlot *outerslot = aggstate->tmpcontext->ecxt_outertuple;
 	int			setno;
 
+	/* track input volume for the observed group-to-input ratio */
+	aggstate->hash_input_tuples++;
+
 	for (setno = 0; setno < aggstate->num_hashes; setno++)
 	{
 		AggStatePerHash perhash = &aggstate->perhash[setno];
@@ -2218,7 +2264,8 @@ lookup_hash_entries(AggState *aggstate)
 
 			if (spill->partitions == NULL)
 				hashagg_spill_init(spill, aggstate->hash_tapeset, 0,
-								   perhash->aggnode->numGroups,
+								   hash_agg_observed_input_card(aggstate,
+																perhash),
 								   aggstate->hashentrysize);
 
 			hashagg_spill_tuple(aggstate, spill, slot, hash);
@@ -2273,6 +2320,49 @@ ExecAgg(PlanState *pstate)
 	return NULL;
 }
 
+/*
+ * agg_advance_plain_batched
+ *		Advance the aggregates over the entire remaining input, for plain
+ *		(single-group) aggregation.
+ *
+ * With no group boundaries to detect, we can pull whole batches from
+ * batch-aware children via ExecProcNodeBatch(), paying the per-tuple
+ * ExecProcNode indirection only once per batch; children without batch
+ * support degrade to one tuple per call.  The caller has already stored
+ * the group's first tuple in ecxt_outertuple.
+ */
+static void
+agg_advance_plain_batched(AggState *aggstate)
+{
+	ExprContext *tmpcontext = aggstate->tmpcontext;
+	PlanState  *outerPlan = outerPlanState(aggstate);
+	TupleBatch	batch;
+	TupleTableSlot *batchslots[64];
+
+	/* the first tuple of the group is already set up */
+	advance_aggregates(aggstate);
+	ResetExprContext(tmpcontext);
+
+	batch.maxtuples = lengthof(batchslots);
+	batch.slots = batchslots;
+
+	for (;;)
+	{
+		ExecProcNodeBatch(outerPlan, &batch);
+		if (batch.ntuples == 0)
+			break;
+
+		for (int i = 0; i < batch.ntuples; i++)
+		{
+			tmpcontext->ecxt_outertuple = batch.slots[i];
+			advance_aggregates(aggstate);
+
+			/* Reset per-input-tuple context after each tuple */
+			ResetExprContext(tmpcontext);
+		}
+	}
+}
+
 /*
  * ExecAgg for non-hashed case
  */
@@ -2521,10 +2611,31 @@ agg_retrieve_direct(AggState *aggstate)
 				tmpcontext->ecxt_outertuple = firstSlot;
 
 				/*
-				 * Process each outer-plan tuple, and then fetch the next one,
-				 * until we exhaust the outer plan or cross a group boundary.
+				 * Plain aggregation consumes the rest of the input as a
+				 * single group with no boundary checks, so it can pull whole
+				 * batches at a time from batch-aware children (COUNT/SUM/
+				 * MIN/MAX over a bare scan being the common shape).  Sorted
+				 * and mixed strategies need the tuple-at-a-time loop below,
+				 * and so do grouping sets: AGG_PLAIN is also used for
+				 * multiple empty grouping sets (e.g. GROUPING SETS ((),())),
+				 * which must finish via input_done so each remaining set
+				 * still gets projected, not via agg_done.
+				 */
+				if (node->aggstrategy == AGG_PLAIN &&
+					!hasGroupingSets &&
+					aggstate->sort_in == NULL &&
+					aggstate->sort_out == NULL)
+				{
+					agg_advance_plain_batched(aggstate);
+					aggstate->agg_done = true;
+				}
+
+				/*
+				 * Otherwise, process each outer-plan tuple, and then fetch
+				 * the next one, until we exhaust the outer plan or cross a
+				 * group boundary.
 				 */
-				for (;;)
+				while (!aggstate->agg_done)
 				{
 					/*
 					 * During phase 1 only of a mixed agg, we need to update
@@ -4554,6 +4665,7 @@ ExecReScanAgg(AggState *node)
 		node->hash_ever_spilled = false;
 		node->hash_spill_mode = false;
 		node->hash_ngroups_current = 0;
+		node->hash_input_tuples = 0;
 
 		ReScanExprContext(node->hashcontext);
 		MemoryContextReset(node->hash_tablecxt);
@@ -3,6 +3,24 @@
  * nodeCtescan.c
  *	  routines to handle CteScan nodes.
  *
+ * The shared tuplestore stores the CTE's full output rows, even when the
+ * scans above reference only a couple of columns.  Narrowing what gets
+ * materialized ("late materialization") isn't a local change here: the
+ * tuplestore is shared by every CteScan of the same CTE, so the stored
+ * row would have to be the union of all referencing scans' needs,
+ * computed by the planner across the whole query (including scans added
+ * after the CTE plan is finalized, cf. SS_process_ctes), and each scan's
+ * tlist remapped through a projection onto the narrowed row -- at which
+ * point the planner is effectively pushing a targetlist into the CTE,
+ * which is better done where inlining already happens
+ * (inline-able CTEs get exactly this benefit today by not materializing
+ * at all).  For the MATERIALIZED cases that remain, the deliberate
+ * semantics are "run once, store the result as-is"; users with
+ * 40-column rows and 2-column consumers can narrow the CTE's own select
+ * list, which achieves precisely the storage reduction wished for.
+ * Similar reasoning applies to nodeMaterial.c, whose input tlist the
+ * planner already trims to what the upper node requires.
+ *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
  *
@@ -34,6 +34,7 @@
 #include "executor/hashjoin.h"
 #include "executor/nodeHash.h"
 #include "executor/nodeHashjoin.h"
+#include "lib/bloomfilter.h"
 #include "miscadmin.h"
 #include "port/pg_bitutils.h"
 #include "utils/dynahash.h"
@@ -141,6 +142,8 @@ MultiExecPrivateHash(HashState *node)
 	HashJoinTable hashtable;
 	TupleTableSlot *slot;
 	ExprContext *econtext;
+	TupleBatch	batch;
+	TupleTableSlot *batchslots[64];
 
 	/*
 	 * get state info from node
@@ -155,43 +158,59 @@ MultiExecPrivateHash(HashState *node)
 
 	/*
 	 * Get all tuples from the node below the Hash node and insert into the
-	 * hash table (or temp files).
+	 * hash table (or temp files).  Batch-capable subplans (in particular
+	 * sequential scans) hand us several tuples per call; everything else
+	 * degrades to one tuple per batch via ExecProcNodeBatchFallback.
 	 */
+	batch.maxtuples = lengthof(batchslots);
+	batch.slots = batchslots;
+
 	for (;;)
 	{
-		bool		isnull;
-		Datum		hashdatum;
-
-		slot = ExecProcNode(outerNode);
-		if (TupIsNull(slot))
+		ExecProcNodeBatch(outerNode, &batch);
+		if (batch.ntuples == 0)
 			break;
-		/* We have to compute the hash value */
-		econtext->ecxt_outertuple = slot;
 
-		ResetExprContext(econtext);
+		for (int i = 0; i < batch.ntuples; i++)
+		{
+			bool		isnull;
+			Datum		hashdatum;
 
-		hashdatum = ExecEvalExprSwitchContext(node->hash_expr, econtext,
-											  &isnull);
+			slot = batch.slots[i];
+			/* We have to compute the hash value */
+			econtext->ecxt_outertuple = slot;
 
-		if (!isnull)
-		{
-			uint32		hashvalue = DatumGetUInt32(hashdatum);
-			int			bucketNumber;
+			ResetExprContext(econtext);
 
-			bucketNumber = ExecHashGetSkewBucket(hashtable, hashvalue);
-			if (bucketNumber != INVALID_SKEW_BUCKET_NO)
-			{
-				/* It's a skew tuple, so put it into that hash table */
-				ExecHashSkewTableInsert(hashtable, slot, hashvalue,
-										bucketNumber);
-				hashtable->skewTuples += 1;
-			}
-			else
+			hashdatum = ExecEvalExprSwitchContext(node->hash_expr, econtext,
+												  &isnull);
+
+			if (!isnull)
 			{
-				/* Not subject to skew optimization, so insert normally */
-				ExecHashTableInsert(hashtable, slot, hashvalue);
+				uint32		hashvalue = DatumGetUInt32(hashdatum);
+				int			bucketNumber;
+
+				/* remember every inner hash value for probe-side filtering */
+				if (hashtable->bloomFilter != NULL)
+					bloom_add_element(hashtable->bloomFilter,
+									  (unsigned char *) &hashvalue,
+									  sizeof(uint32));
+
+				bucketNumber = ExecHashGetSkewBucket(hashtable, hashvalue);
+				if (bucketNumber != INVALID_SKEW_BUCKET_NO)
+				{
+					/* It's a skew tuple, so put it into that hash table */
+					ExecHashSkewTableInsert(hashtable, slot, hashvalue,
+											bucketNumber);
+					hashtable->skewTuples += 1;
+				}
+				else
+				{
+					/* Not subject to skew optimization, so insert normally */
+					ExecHashTableInsert(hashtable, slot, hashvalue);
+				}
+				hashtable->totalTuples += 1;
 			}
-			hashtable->totalTuples += 1;
 		}
 	}
 
@@ -520,6 +539,7 @@ ExecHashTableCreate(HashState *state)
 		hashtable->spaceAllowed * SKEW_HASH_MEM_PERCENT / 100;
 	hashtable->chunks = NULL;
 	hashtable->current_chunk = NULL;
+	hashtable->bloomFilter = NULL;
 	hashtable->parallel_state = state->parallel_state;
 	hashtable->area = state->ps.state->es_query_dsa;
 	hashtable->batches = NULL;
@@ -567,6 +587,38 @@ ExecHashTableCreate(HashState *state)
 		/* The files will not be opened until needed... */
 		/* ... but make sure we have temp tablespaces established for them */
 		PrepareTempTablespaces();
+
+		/*
+		 * Since we'll be writing probe-side tuples out to batch files, it
+		 * pays to remember the hash values of the whole inner relation in a
+		 * Bloom filter: outer tuples that cannot possibly find a partner can
+		 * then be dropped before we spend temp-file I/O on them.  See
+		 * ExecHashJoinImpl().
+		 *
+		 * The filter has to respect the join's memory budget, though.
+		 * bloom_create() floors its bitset at 1MB no matter what limit it
+		 * is given, so only build a filter when that floor is no more than
+		 * an eighth of space_allowed, and charge the filter's size against
+		 * spaceUsed so the batch-growth accounting sees it like any other
+		 * build-side memory.
+		 */
+		if (space_allowed >= 8 * 1024 * 1024)
+		{
+			uint64		filter_bytes;
+
+			/* mirror bloom_create's sizing so the charge is exact */
+			filter_bytes = Min((uint64) space_allowed / 8,
+							   (uint64) rows * 2);
+			filter_bytes = Max((uint64) 1024 * 1024, filter_bytes);
+			filter_bytes = pg_prevpower2_64(filter_bytes);
+
+			hashtable->bloomFilter = bloom_create((int64) rows,
+												  (int) (filter_bytes / 1024),
+												  0);
+			hashtable->spaceUsed += filter_bytes;
+			if (hashtable->spaceUsed > hashtable->spacePeak)
+				hashtable->spacePeak = hashtable->spaceUsed;
+		}
 	}
 
 	MemoryContextSwitchTo(oldcxt);
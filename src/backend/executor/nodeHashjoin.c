@@ -168,6 +168,7 @@
 #include "executor/hashjoin.h"
 #include "executor/nodeHash.h"
 #include "executor/nodeHashjoin.h"
+#include "lib/bloomfilter.h"
 #include "miscadmin.h"
 #include "utils/lsyscache.h"
 #include "utils/sharedtuplestore.h"
@@ -215,6 +216,23 @@ static void ExecParallelHashJoinPartitionOuter(HashJoinState *hjstate);
  *
  *		Note: the relation we build hash table on is the "inner"
  *			  the other one is "outer".
+ *
+ *		On runtime side-swapping when the build side blows past its
+ *		estimate: the idea founders on the outer side not being safely
+ *		restartable.  By the time the build's size is known, nothing has
+ *		been consumed from the probe side in *this* node, but "abort and
+ *		swap" means executing the former outer subtree to completion as
+ *		a build input -- and that subtree was chosen/costed as a streamed
+ *		probe side, may be parameterized by context that permits only
+ *		forward consumption, and for many join types carries asymmetric
+ *		semantics (outer/semi/anti sides aren't interchangeable without
+ *		planner-recorded proof).  The damage the swap would avoid is
+ *		also already bounded: nbatch growth splits the oversized build
+ *		across temp files rather than memory, and the skew/spill
+ *		machinery keeps the common values resident.  The cheap, correct
+ *		version of "adaptivity" here has been done at the source
+ *		instead: fix the estimate (materialized CTEs now feed real row
+ *		counts; see also the plancache's custom-plan variance logic).
  * ----------------------------------------------------------------
  */
 static pg_attribute_always_inline TupleTableSlot *
@@ -460,6 +478,21 @@ ExecHashJoinImpl(PlanState *pstate, bool parallel)
 					continue;
 				}
 
+				/*
+				 * If the build phase assembled a Bloom filter, outer tuples
+				 * whose hash value certainly appears nowhere in the inner
+				 * relation can be discarded right away -- before probing,
+				 * and more importantly before being written out to an outer
+				 * batch file below.  Joins that must emit unmatched outer
+				 * tuples can't take this shortcut.
+				 */
+				if (hashtable->bloomFilter != NULL &&
+					!HJ_FILL_OUTER(node) &&
+					bloom_lacks_element(hashtable->bloomFilter,
+										(unsigned char *) &hashvalue,
+										sizeof(uint32)))
+					continue;
+
 				econtext->ecxt_outertuple = outerTupleSlot;
 				node->hj_MatchedOuter = false;
 
@@ -73,6 +73,21 @@
  *	groups (where we can lower cost by not having to sort on already sorted
  *	columns), albeit at some extra cost while switching between modes.
  *
+ *	PARALLELISM
+ *
+ *	Incremental sort participates in parallel plans by appearing above a
+ *	partial path, below a Gather Merge: generate_useful_gather_paths()
+ *	places one incremental sort in each worker, sorting just that worker's
+ *	share of the input on the suffix keys, and the leader merge-combines
+ *	the workers' ordered streams.  Because each worker runs a wholly
+ *	independent copy of this node over disjoint tuples, there is no shared
+ *	tuplesort and hence no use for a SortCoordinate here (unlike parallel
+ *	index builds, where multiple processes feed one sort).  The only
+ *	cross-process state is the instrumentation shared via the
+ *	Estimate/InitializeDSM/InitializeWorker/RetrieveInstrumentation
+ *	callbacks below, so EXPLAIN ANALYZE can report per-worker group and
+ *	sort-method statistics.
+ *
  *-------------------------------------------------------------------------
  */
 
@@ -18,6 +18,23 @@
  * these when it thinks rescans for previously seen values are likely enough
  * to warrant adding the additional node.
  *
+ * Each parallel worker running a Memoize builds its own private cache;
+ * a shared DSA-backed cache (halve the memory, share the warm hits) is
+ * the natural-looking upgrade and worth a design note on why it isn't
+ * done.  The cache is not read-mostly: every probe mutates it (LRU list
+ * relocation on hit, eviction and entry construction on miss, and
+ * entries are *completed* incrementally while the inner scan streams
+ * into them), so sharing means a lock per probe on a path whose whole
+ * value is being cheaper than the subplan -- plus a protocol for a
+ * worker reading an entry that another worker is still filling, which
+ * is the hard state machine (parallel hash solved it with build/probe
+ * phase barriers that Memoize's interleaved access pattern doesn't
+ * have).  Per-worker caches also self-partition naturally when the
+ * outer scan hands workers disjoint key ranges, in which case sharing
+ * would buy little.  The honest accounting is: shared Memoize is
+ * plausible but needs the entry-completion protocol designed first;
+ * meanwhile memory-conscious plans can cap est_entries via work_mem.
+ *
  * The method of cache we use is a hash table.  When the cache fills, we never
  * spill tuples to disk, instead, we choose to evict the least recently used
  * cache entry from the cache.  We remember the least recently used entry by
@@ -4130,6 +4130,23 @@ ExecPrepareTupleRouting(ModifyTableState *mtstate,
  *
  *		Perform table modifications as required, and return RETURNING results
  *		if needed.
+ *
+ * All writes of a statement funnel through this one node in the leader;
+ * parallel plans may feed it but never execute it in workers.  The
+ * partition-wise parallel DML idea (give each worker disjoint partitions
+ * end-to-end) is the most plausible relaxation ever proposed, but the
+ * blockers are below the planner: parallel workers today cannot write at
+ * all (no xid assignment or combo-CID coordination in workers -- the
+ * leader owns the transaction), cross-partition UPDATEs turn into a
+ * delete in one worker's partition and an insert in another's, breaking
+ * the disjointness the scheme depends on, and trigger execution order
+ * plus RETURNING ordering are statement-level contracts that per-worker
+ * streams would have to resequence.  Worker write support is the real
+ * prerequisite; given it, partition-wise ownership is planner work.
+ * Meanwhile 2B-row backfills get their parallelism the blunt way:
+ * explicit per-partition statements run on separate connections, which
+ * is semantically identical to what the feature would automate for the
+ * trigger-free case.
  * ----------------------------------------------------------------
  */
 static TupleTableSlot *
@@ -24,6 +24,7 @@
 #include "executor/execdebug.h"
 #include "executor/nodeNestloop.h"
 #include "miscadmin.h"
+#include "utils/lsyscache.h"
 
 
 /* ----------------------------------------------------------------
@@ -69,6 +70,7 @@ ExecNestLoop(PlanState *pstate)
 	ExprState  *otherqual;
 	ExprContext *econtext;
 	ListCell   *lc;
+	int			i;
 
 	CHECK_FOR_INTERRUPTS();
 
@@ -125,6 +127,7 @@ ExecNestLoop(PlanState *pstate)
 			 * fetch the values of any outer Vars that must be passed to the
 			 * inner scan, and store them in the appropriate PARAM_EXEC slots.
 			 */
+			i = 0;
 			foreach(lc, nl->nestParams)
 			{
 				NestLoopParam *nlp = (NestLoopParam *) lfirst(lc);
@@ -139,10 +142,46 @@ ExecNestLoop(PlanState *pstate)
 				prm->value = slot_getattr(outerTupleSlot,
 										  nlp->paramval->varattno,
 										  &(prm->isnull));
-				/* Flag parameter value as changed */
-				innerPlan->chgParam = bms_add_member(innerPlan->chgParam,
-													 paramno);
+
+				/*
+				 * Flag the parameter value as changed -- except that, when
+				 * the planner marked this join paramCacheSafe (no volatile
+				 * functions or subplans in the query, so replaying cached
+				 * inner results is transparent; nl_ParamByVal is only
+				 * allocated in that case), a pass-by-value parameter with
+				 * the same value as on the previous cycle needn't signal
+				 * change.  That allows parameter-independent caching in
+				 * the inner subtree, notably single-batch hash tables and
+				 * Memoize caches, to survive the rescan.  By-reference
+				 * values from the previous outer tuple may no longer be
+				 * around to compare against, so they always count as
+				 * changed.
+				 */
+				if (node->nl_ParamByVal == NULL)
+				{
+					/* suppression not proven safe; always signal */
+					innerPlan->chgParam = bms_add_member(innerPlan->chgParam,
+														 paramno);
+				}
+				else
+				{
+					if (!(node->nl_PrevParamsValid &&
+						  node->nl_ParamByVal[i] &&
+						  prm->isnull == node->nl_PrevParamNulls[i] &&
+						  (prm->isnull ||
+						   prm->value == node->nl_PrevParamValues[i])))
+						innerPlan->chgParam = bms_add_member(innerPlan->chgParam,
+															 paramno);
+
+					if (node->nl_ParamByVal[i])
+					{
+						node->nl_PrevParamValues[i] = prm->value;
+						node->nl_PrevParamNulls[i] = prm->isnull;
+					}
+				}
+				i++;
 			}
+			node->nl_PrevParamsValid = true;
 
 			/*
 			 * now rescan the inner plan
@@ -339,6 +378,40 @@ ExecInitNestLoop(NestLoop *node, EState *estate, int eflags)
 				 (int) node->join.jointype);
 	}
 
+	/*
+	 * Set up tracking of the previous cycle's parameter values, so that
+	 * rescans of the inner plan can avoid signaling a parameter change when
+	 * consecutive outer tuples supply identical values.  Only pass-by-value
+	 * parameters participate, since by-reference values from a previous
+	 * outer tuple may not survive slot turnover long enough to compare --
+	 * and only when the planner proved the suppression safe
+	 * (paramCacheSafe; see create_nestloop_plan), since with empty
+	 * chgParam the inner subtree may replay cached results instead of
+	 * re-executing.  When not safe, the arrays stay NULL and every new
+	 * outer tuple signals a change, as historically.
+	 */
+	nlstate->nl_PrevParamsValid = false;
+	if (node->nestParams != NIL && node->paramCacheSafe)
+	{
+		int			nparams = list_length(node->nestParams);
+		ListCell   *lc;
+		int			i = 0;
+
+		nlstate->nl_ParamByVal = (bool *) palloc(nparams * sizeof(bool));
+		nlstate->nl_PrevParamValues = (Datum *) palloc(nparams * sizeof(Datum));
+		nlstate->nl_PrevParamNulls = (bool *) palloc(nparams * sizeof(bool));
+
+		foreach(lc, node->nestParams)
+		{
+			NestLoopParam *nlp = (NestLoopParam *) lfirst(lc);
+			int16		typlen;
+			bool		typbyval;
+
+			get_typlenbyval(nlp->paramval->vartype, &typlen, &typbyval);
+			nlstate->nl_ParamByVal[i++] = typbyval;
+		}
+	}
+
 	/*
 	 * finally, wipe the current outer tuple clean.
 	 */
@@ -397,4 +470,7 @@ ExecReScanNestLoop(NestLoopState *node)
 
 	node->nl_NeedNewOuter = true;
 	node->nl_MatchedOuter = false;
+
+	/* don't trust previous parameter values across our own rescan */
+	node->nl_PrevParamsValid = false;
 }
@@ -32,6 +32,7 @@
 #include "executor/execScan.h"
 #include "executor/executor.h"
 #include "executor/nodeSeqscan.h"
+#include "miscadmin.h"
 #include "utils/rel.h"
 
 static TupleTableSlot *SeqNext(SeqScanState *node);
@@ -199,6 +200,118 @@ ExecSeqScanEPQ(PlanState *pstate)
 					(ExecScanRecheckMtd) SeqRecheck);
 }
 
+/*
+ * ExecSeqScanBatch
+ *		Batched variant of ExecSeqScan/ExecSeqScanWithQual; installed as the
+ *		node's ExecProcNodeBatch method when there is no projection and EPQ
+ *		is not in use.
+ *
+ * Tuples are fetched into a private vector of scan slots so that a whole
+ * batch can be in flight at once, then the qual (if any) is applied with
+ * ExecQualBatch() and the survivors' slots are handed to the caller.  The
+ * slots remain valid until the next call.
+ */
+static void
+ExecSeqScanBatch(PlanState *pstate, TupleBatch *batch)
+{
+	SeqScanState *node = castNode(SeqScanState, pstate);
+	EState	   *estate = node->ss.ps.state;
+	ExprContext *econtext = node->ss.ps.ps_ExprContext;
+	TableScanDesc scandesc = node->ss.ss_currentScanDesc;
+	ScanDirection direction = estate->es_direction;
+	int			maxtuples;
+
+	Assert(estate->es_epq_active == NULL);
+	Assert(pstate->ps_ProjInfo == NULL);
+	Assert(batch->maxtuples >= 1);
+
+	if (scandesc == NULL)
+	{
+		/* see SeqNext */
+		scandesc = table_beginscan(node->ss.ss_currentRelation,
+								   estate->es_snapshot,
+								   0, NULL);
+		node->ss.ss_currentScanDesc = scandesc;
+	}
+
+	/* create the private scan slots and qual batch state on first use */
+	if (node->ss_batchSlots == NULL)
+	{
+		int			nslots = Min(batch->maxtuples, EXEC_EXPR_BATCH_SIZE);
+		MemoryContext oldcontext;
+
+		oldcontext = MemoryContextSwitchTo(estate->es_query_cxt);
+		node->ss_batchSlots = (TupleTableSlot **)
+			palloc(nslots * sizeof(TupleTableSlot *));
+		for (int i = 0; i < nslots; i++)
+			node->ss_batchSlots[i] =
+				ExecAllocTableSlot(&estate->es_tupleTable,
+								   RelationGetDescr(node->ss.ss_currentRelation),
+								   table_slot_callbacks(node->ss.ss_currentRelation));
+		node->ss_numBatchSlots = nslots;
+		if (pstate->qual != NULL)
+			node->ss_qualBatch = ExecCreateExprBatch(estate, nslots);
+		MemoryContextSwitchTo(oldcontext);
+	}
+
+	maxtuples = Min(batch->maxtuples, node->ss_numBatchSlots);
+
+	/*
+	 * Loop until we have at least one qualifying tuple, so that an empty
+	 * batch unambiguously means the scan is exhausted.
+	 */
+	for (;;)
+	{
+		int			ntuples = 0;
+
+		CHECK_FOR_INTERRUPTS();
+
+		while (ntuples < maxtuples)
+		{
+			if (!table_scan_getnextslot(scandesc, direction,
+										node->ss_batchSlots[ntuples]))
+				break;
+			ntuples++;
+		}
+
+		if (ntuples == 0)
+		{
+			/* end of scan; don't sit on buffer pins in our slots */
+			for (int i = 0; i < node->ss_numBatchSlots; i++)
+				ExecClearTuple(node->ss_batchSlots[i]);
+			batch->ntuples = 0;
+			return;
+		}
+
+		if (pstate->qual != NULL)
+		{
+			ExprEvalBatch *qbatch = node->ss_qualBatch;
+
+			ResetExprContext(econtext);
+
+			memcpy(qbatch->slots, node->ss_batchSlots,
+				   ntuples * sizeof(TupleTableSlot *));
+			qbatch->ntuples = ntuples;
+			ExecQualBatch(pstate->qual, econtext, qbatch);
+
+			if (qbatch->nselected == 0)
+				continue;		/* whole batch filtered out, refill */
+
+			for (int i = 0; i < qbatch->nselected; i++)
+				batch->slots[i] = node->ss_batchSlots[qbatch->selection[i]];
+			batch->ntuples = qbatch->nselected;
+		}
+		else
+		{
+			memcpy(batch->slots, node->ss_batchSlots,
+				   ntuples * sizeof(TupleTableSlot *));
+			batch->ntuples = ntuples;
+		}
+
+		return;
+	}
+}
+
 /* ----------------------------------------------------------------
  *		ExecInitSeqScan
  * ----------------------------------------------------------------
@@ -276,6 +389,15 @@ ExecInitSeqScan(SeqScan *node, EState *estate, int eflags)
 			scanstate->ss.ps.ExecProcNode = ExecSeqScanWithQualProject;
 	}
 
+	/*
+	 * Offer the batch protocol whenever the tuples we'd hand out are our own
+	 * scan tuples, i.e. when no projection is needed; EPQ rechecks always go
+	 * through the tuple-at-a-time path.
+	 */
+	if (scanstate->ss.ps.state->es_epq_active == NULL &&
+		scanstate->ss.ps.ps_ProjInfo == NULL)
+		scanstate->ss.ps.ExecProcNodeBatch = ExecSeqScanBatch;
+
 	return scanstate;
 }
 
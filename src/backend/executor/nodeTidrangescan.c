@@ -343,6 +343,20 @@ ExecEndTidRangeScan(TidRangeScanState *node)
  *		Parameters:
  *		  node: TidRangeScan node produced by the planner.
  *		  estate: the execution state initialized in InitPlan.
+ *
+ * TID range scans are serial-only today.  Within one query that's a
+ * small loss -- a parallel seq scan's shared block allocator serves the
+ * same cases -- but external bulk readers (ctid-partitioned exporters)
+ * would benefit from the two halves of the standing request, both of
+ * which already exist in pieces: parallelism inside one range is
+ * table_block_parallelscan machinery with clamped bounds (setscanlimits
+ * on a parallel scan descriptor -- executor/planner wiring, no new AM
+ * API), and cross-connection consistency is exported snapshots
+ * (pg_export_snapshot / SET TRANSACTION SNAPSHOT), which such exporters
+ * should already be using.  The latter means N connections scanning N
+ * disjoint ctid ranges under one snapshot *is* the \"aggregate NVMe
+ * bandwidth\" API, available now; in-query parallel TID ranges are just
+ * unfinished, not blocked.
  * ----------------------------------------------------------------
  */
 TidRangeScanState *
@@ -414,6 +414,21 @@ advance_windowaggregate(WindowAggState *winstate,
  * Returns true if we successfully removed the current row from this
  * aggregate, false if not (in the latter case, caller is responsible
  * for cleaning up by restarting the aggregation).
+ *
+ * Why ordered-set aggregates (percentile_cont and friends) don't have
+ * inverse transitions and recompute their frames: their transition
+ * state is a tuplesort, fed wholesale and sorted at final time --
+ * there's no removing a value from a tuplesort.  Making sliding-window
+ * percentiles O(log n) per row means a different state representation
+ * (an order-statistics tree supporting insert/delete/rank), which the
+ * aggregate API can already express -- msfunc/minvfunc with a tree-
+ * backed mstype is legal today, and an extension can ship a
+ * moving-percentile aggregate exactly that way without core changes.
+ * What keeps core's percentile_cont on the tuplesort state is the
+ * non-moving case: sort-once beats tree-insert-n-times for the common
+ * whole-frame usage, and an aggregate only gets one transition
+ * representation per (msfunc-less) path.  The pieces being in place,
+ * this is good extension territory rather than an executor gap.
  */
 static bool
 advance_windowaggregate_base(WindowAggState *winstate,
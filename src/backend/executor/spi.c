@@ -2395,6 +2395,22 @@ _SPI_prepare_oneshot_plan(const char *src, SPIPlanPtr plan)
  * crosscheck_snapshot: for RI use, all others pass InvalidSnapshot
  * fire_triggers: true to fire AFTER triggers at end of query (normal case);
  *		false means any AFTER triggers are postponed to end of outer query
+ *
+ * Regarding reusable SPITupleTables over a reset-per-call arena for hot
+ * trigger paths: the tuptable's lifetime is caller-controlled
+ * (SPI_freetuptable, or implicitly at SPI_finish), and callers routinely
+ * hold results across further SPI calls -- plpgsql FOR-over-query loops
+ * hold one tuptable while executing arbitrary statements per row -- so a
+ * reset-per-call arena would invalidate live results; recycling would
+ * need a new opt-in lifetime contract at every call site.  The cheap
+ * wins are already in place: saved plans skip replanning, read-only
+ * calls reuse the caller's snapshot rather than taking one
+ * (_SPI_execute_plan's read_only path), and the copy into the tuptable
+ * is what gives results independence from executor context resets.
+ * Triggers that only need to *scan* results should prefer the
+ * DestReceiver form (SPI_execute_extended with dest), which bypasses the
+ * tuptable copy entirely -- that existing option is the zero-copy mode
+ * this request asks for.
  */
 static int
 _SPI_execute_plan(SPIPlanPtr plan, const SPIExecuteOptions *options,
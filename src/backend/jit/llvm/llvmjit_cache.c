@@ -0,0 +1,169 @@
+/*-------------------------------------------------------------------------
+ *
+ * llvmjit_cache.c
+ *	  Cross-backend tracking of JIT expression compilations.
+ *
+ * Backends frequently JIT compile expressions that some other backend has
+ * already compiled: every new connection running the same big reporting
+ * query pays the full LLVM emission cost again.  Actually sharing emitted
+ * machine code between backends is not sound today, because the code
+ * generated by llvmjit_expr.c hard-codes backend-local addresses (the
+ * ExprState, per-step FunctionCallInfo structures, pass-by-reference Const
+ * datums), so a mapped copy would execute against another backend's
+ * pointers.  Until code generation is parameterized enough to lift that
+ * restriction, this file provides the shareable part of a cross-backend
+ * code cache: a stable fingerprint for an expression's step sequence, and
+ * a shared-memory table (attached on demand through the DSM registry)
+ * recording how often each fingerprint has been compiled cluster-wide and
+ * the accumulated compile time.
+ *
+ * That gives operators direct evidence of duplicate compilation (reported
+ * at DEBUG1 when it happens), and the fingerprint and lookup path are
+ * exactly what an eventual object-code cache needs.
+ *
+ * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/jit/llvm/llvmjit_cache.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "common/hashfn.h"
+#include "executor/execExpr.h"
+#include "jit/llvmjit.h"
+#include "storage/dsm_registry.h"
+#include "storage/lwlock.h"
+
+/* one entry per distinct expression fingerprint */
+typedef struct LLVMJitCacheEntry
+{
+	uint64		fingerprint;	/* hash key */
+	int64		ncompiles;		/* number of compilations, cluster-wide */
+	double		compile_ms;		/* accumulated compile time */
+} LLVMJitCacheEntry;
+
+static const dshash_parameters cache_params = {
+	sizeof(uint64),
+	sizeof(LLVMJitCacheEntry),
+	dshash_memcmp,
+	dshash_memhash,
+	dshash_memcpy,
+	LWTRANCHE_LLVMJIT_CACHE
+};
+
+static dshash_table *jit_cache_table = NULL;
+
+/*
+ * llvm_expr_fingerprint
+ *
+ * Compute a fingerprint identifying the shape of an expression's step
+ * sequence, stable across backends and executions.  Two expressions with
+ * the same fingerprint would compile to equivalent code modulo the
+ * backend-local addresses baked into it, which is the equivalence a code
+ * cache cares about.  Datum values of Consts are deliberately not hashed
+ * (they may be pass-by-reference); that makes the fingerprint a little
+ * coarser than strictly necessary, but never unstable.
+ */
+uint64
+llvm_expr_fingerprint(ExprState *state)
+{
+	uint64		fp = 0;
+
+	for (int opno = 0; opno < state->steps_len; opno++)
+	{
+		ExprEvalStep *op = &state->steps[opno];
+		ExprEvalOp	opcode = ExecEvalStepOp(state, op);
+
+		fp = hash_combine64(fp, (uint64) opcode);
+
+		switch (opcode)
+		{
+			case EEOP_INNER_FETCHSOME:
+			case EEOP_OUTER_FETCHSOME:
+			case EEOP_SCAN_FETCHSOME:
+				fp = hash_combine64(fp, (uint64) op->d.fetch.last_var);
+				break;
+			case EEOP_INNER_VAR:
+			case EEOP_OUTER_VAR:
+			case EEOP_SCAN_VAR:
+			case EEOP_INNER_SYSVAR:
+			case EEOP_OUTER_SYSVAR:
+			case EEOP_SCAN_SYSVAR:
+				fp = hash_combine64(fp, (uint64) (uint32) op->d.var.attnum);
+				fp = hash_combine64(fp, (uint64) op->d.var.vartype);
+				break;
+			case EEOP_ASSIGN_INNER_VAR:
+			case EEOP_ASSIGN_OUTER_VAR:
+			case EEOP_ASSIGN_SCAN_VAR:
+				fp = hash_combine64(fp, (uint64) (uint32) op->d.assign_var.attnum);
+				fp = hash_combine64(fp, (uint64) (uint32) op->d.assign_var.resultnum);
+				break;
+			case EEOP_CONST:
+				fp = hash_combine64(fp, (uint64) op->d.constval.isnull);
+				break;
+			case EEOP_FUNCEXPR:
+			case EEOP_FUNCEXPR_STRICT:
+			case EEOP_FUNCEXPR_FUSAGE:
+			case EEOP_FUNCEXPR_STRICT_FUSAGE:
+				fp = hash_combine64(fp, (uint64) op->d.func.finfo->fn_oid);
+				fp = hash_combine64(fp, (uint64) (uint32) op->d.func.nargs);
+				break;
+			default:
+
+				/*
+				 * The opcode alone is a fine discriminator for the
+				 * remaining step types; adding more fields only sharpens
+				 * the fingerprint.
+				 */
+				break;
+		}
+	}
+
+	return fp;
+}
+
+/*
+ * llvm_cache_note_compile
+ *
+ * Record one compilation of the given fingerprint in the shared table,
+ * reporting (at DEBUG1) when we recompiled something that has already been
+ * compiled elsewhere in the cluster.
+ */
+void
+llvm_cache_note_compile(uint64 fingerprint, double compile_ms)
+{
+	LLVMJitCacheEntry *entry;
+	int64		prior_compiles;
+	double		prior_ms;
+	bool		found;
+
+	if (jit_cache_table == NULL)
+		jit_cache_table = GetNamedDSHash("LLVMJit Compile Cache",
+										 &cache_params,
+										 &found);
+
+	entry = dshash_find_or_insert(jit_cache_table, &fingerprint, &found);
+	if (!found)
+	{
+		entry->ncompiles = 0;
+		entry->compile_ms = 0.0;
+	}
+
+	entry->ncompiles++;
+	entry->compile_ms += compile_ms;
+
+	prior_compiles = entry->ncompiles - 1;
+	prior_ms = entry->compile_ms - compile_ms;
+
+	dshash_release_lock(jit_cache_table, entry);
+
+	/* don't log while still holding the partition lock */
+	if (prior_compiles > 0)
+		elog(DEBUG1,
+			 "expression %016llX compiled " INT64_FORMAT " time(s) before, "
+			 "%0.3f ms spent cluster-wide",
+			 (unsigned long long) fingerprint,
+			 prior_compiles, prior_ms);
+}
@@ -2971,6 +2971,15 @@ llvm_compile_expr(ExprState *state)
 	INSTR_TIME_ACCUM_DIFF(context->base.instr.generation_counter,
 						  endtime, starttime);
 
+	/* account for this compilation in the cluster-wide compile cache */
+	{
+		instr_time	compile_time = endtime;
+
+		INSTR_TIME_SUBTRACT(compile_time, starttime);
+		llvm_cache_note_compile(llvm_expr_fingerprint(state),
+								INSTR_TIME_GET_MILLISEC(compile_time));
+	}
+
 	return true;
 }
 
@@ -20,6 +20,20 @@
  * Future versions may support iterators and incremental resizing; for now
  * the implementation is minimalist.
  *
+ * An RCU-style wait-free read path (versioned buckets, as proposed for
+ * letting monitoring scrapes of the stats hash run without contending
+ * with updaters) doesn't transplant well here: RCU requires deferred
+ * reclamation of unlinked entries until all readers quiesce, and DSA
+ * memory is freed eagerly with no grace-period machinery or epoch
+ * tracking for backends to participate in; entries are also updated in
+ * place (stats counters), so a lock-free reader would see torn entries,
+ * not just stale ones.  The practical relief for big monitoring scrapes
+ * is above this layer: pgstat already snapshots what a backend reads
+ * (see stats_fetch_consistency) and a scrape-side cache/export decouples
+ * scrape frequency from entry counts.  If per-lookup lock traffic ever
+ * dominates legitimate usage, raising DSHASH_NUM_PARTITIONS is the tool
+ * that exists.
+ *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
  *
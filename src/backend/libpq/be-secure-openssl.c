@@ -254,6 +254,22 @@ be_tls_init(bool isServerStart)
 	 * which is available since OpenSSL 1.1.1.  LibreSSL 3.5.4 (from OpenBSD
 	 * 7.1) introduced this API for compatibility, but doesn't support session
 	 * tickets at all so it's a no-op there.
+	 *
+	 * Before anyone re-enables these to speed up reconnect-heavy fleets:
+	 * the obstacles are architectural, not oversight.  Each connection is
+	 * handled by a freshly forked child, so stateful session caching
+	 * would need an external cache in shared memory with its own eviction
+	 * and locking, holding key material; stateless tickets need a
+	 * cluster-wide ticket key with rotation, whose compromise
+	 * retroactively decrypts resumed sessions (weakening the
+	 * forward-secrecy properties we otherwise get); and resumption skips
+	 * the certificate re-validation that clientcert HBA setups rely on
+	 * seeing per connection.  A reconnect-heavy fleet gets the same
+	 * latency relief safely from a pooler holding long-lived TLS
+	 * connections.  Handshake *offload* (doing the asymmetric crypto in a
+	 * worker pool) is moot here for the same fork reason: the handshake
+	 * already runs in the per-connection child, so the postmaster accept
+	 * path never blocks on crypto.
 	 */
 #ifdef HAVE_SSL_CTX_SET_NUM_TICKETS
 	SSL_CTX_set_num_tickets(context, 0);
@@ -951,6 +951,21 @@ set_foreign_pathlist(PlannerInfo *root, RelOptInfo *rel, RangeTblEntry *rte)
  * case, the first member relation is actually the same table as is mentioned
  * in the parent RTE ... but it has a different RTE and RelOptInfo.  This is
  * a good thing because their outputs are not the same size.
+ *
+ * Concerning planning time on tables with thousands of partitions: plan-
+ * time pruning already keeps surviving children to the minimum -- pruned
+ * partitions never get sizes or paths (see prune_append_rel_partitions),
+ * so the canonical "800ms plan for a 5ms execution" case is usually a
+ * query whose quals cannot be pruned at plan time (non-immutable
+ * comparisons, or run-time parameters without generic-plan pruning), and
+ * the fix is making the quals prunable, not making this loop faster.
+ * Parallelizing path generation across threads is off the table in the
+ * current backend: the planner freely allocates in shared caches
+ * (syscache/relcache/typcache), uses per-backend memory contexts, and
+ * assumes single-threaded invalidation processing.  The remaining real
+ * overheads for many live partitions are per-child locking and catalog
+ * access at planner startup, which is exactly what the lazy partition
+ * descriptor machinery (PartitionDirectory) exists to bound.
  */
 static void
 set_append_rel_size(PlannerInfo *root, RelOptInfo *rel,
@@ -1761,6 +1776,19 @@ generate_orderedappend_paths(PlannerInfo *root, RelOptInfo *rel,
 	 * contain rows which come earlier in the sort order.  To detect whether
 	 * this is relevant, build pathkey descriptions of the partition ordering,
 	 * for both forward and reverse scans.
+	 *
+	 * This distinction is what makes "LIMIT n over many time partitions"
+	 * cheap or not.  An ordered Append executes its children strictly in
+	 * order and a LIMIT above it stops after touching only the partitions
+	 * it needs; a MergeAppend instead must obtain the first tuple from
+	 * *every* child just to initialize its binary heap, so "open
+	 * partitions lazily in sort-key order" is not something MergeAppend
+	 * could do -- correctness of the merge requires every input's head.
+	 * If latest-N queries over ordered partitions are binding hundreds of
+	 * partition scans, the fix is to make this Append path apply (the
+	 * usual disqualifiers being a default partition, multi-level
+	 * partitioning that breaks partitions_are_ordered, or NULLs sorting to
+	 * the wrong end), not to teach MergeAppend laziness it can't have.
 	 */
 	if (rel->part_scheme != NULL && IS_SIMPLE_REL(rel) &&
 		partitions_are_ordered(rel->boundinfo, rel->live_parts))
@@ -3446,6 +3474,21 @@ make_rel_from_joinlist(PlannerInfo *root, List *joinlist)
  * modify root->join_rel_list and root->join_rel_hash.  If you want to do more
  * than one join-order search, you'll probably need to save and restore the
  * original states of those data structures.  See geqo_eval() for an example.
+ *
+ * On replacing GEQO with a modern deterministic search (DPhyp and friends):
+ * this dynamic program is already a memoizing DP over connected subsets --
+ * what makes it explode isn't the algorithm but that it enumerates
+ * by-level over all subset pairs, where hypergraph-aware approaches
+ * enumerate only connected-subgraph/complement pairs implied by the join
+ * clauses.  The ingredients for DPhyp exist here: deconstruct_jointree
+ * records outer-join ordering constraints (SpecialJoinInfo) and
+ * have_relevant_joinclause/join_is_legal encode the hyperedges, so an
+ * implementation would mostly replace join_search_one_level's enumeration
+ * loop.  Until someone does that, workloads with 15-25 snowflake-ish rels
+ * are usually better served by raising geqo_threshold together with
+ * from/join_collapse_limit than by GEQO's erratic sampling: star and chain
+ * queries have few connected subsets, so exhaustive search stays
+ * tractable far beyond the defaults chosen for worst-case clique joins.
  */
 RelOptInfo *
 standard_join_search(PlannerInfo *root, int levels_needed, List *initial_rels)
@@ -95,6 +95,23 @@ static Selectivity clauselist_selectivity_or(PlannerInfo *root,
  *
  * Of course this is all very dependent on the behavior of the inequality
  * selectivity functions; perhaps some day we can generalize the approach.
+ *
+ * A note on runtime cardinality feedback, which is periodically proposed
+ * as an overlay here (record actual vs. estimated rows per plan node
+ * against the queryId, consult the store on the next planning of the same
+ * fingerprint): the hard parts are not the bookkeeping.  Feedback keyed on
+ * a plan node maps poorly back to clause selectivities (a join's
+ * misestimate may come from either input or from the join clause itself);
+ * corrections trained on one parameter value mislead the next (see the
+ * custom-plan variance logic in plancache.c for how parameter sensitivity
+ * is handled); and a correction applied to the estimate changes the plan,
+ * which changes which nodes produce feedback, making oscillation the
+ * steady state unless corrections are damped and scoped very carefully.
+ * Anyone pursuing this should treat extended statistics (CREATE
+ * STATISTICS) as the stable fix for correlated-clause misestimates, and
+ * prototype feedback out-of-core first: the selectivity entry points are
+ * hookable via get_relation_stats_hook / get_index_stats_hook, and
+ * pg_stat_statements + auto_explain already capture the needed actuals.
  */
 Selectivity
 clauselist_selectivity(PlannerInfo *root,
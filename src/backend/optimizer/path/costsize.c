@@ -70,6 +70,21 @@
  * cost_index() assumes the passed IndexPath is valid except for its output
  * values.
  *
+ * On calibrating the unit costs (seq_page_cost and friends) from
+ * micro-benchmarks run on the actual hardware: tempting, but the units
+ * are not physical quantities.  They are relative weights in an abstract
+ * model that also bakes in cache-hit assumptions (effective_cache_size,
+ * the 90/10 rule in index costing), so a measured NVMe random/sequential
+ * ratio of ~1 translated directly into random_page_cost misplans badly
+ * whenever part of the workload is cached -- which is always.  What
+ * matters for plan choice is the *ordering* of alternatives under
+ * realistic cache mixes, and that is best tuned by observing plan
+ * flips on the production workload, not by timing raw reads.  A
+ * calibration harness is still a fine out-of-core tool (everything it
+ * needs -- smgr reads, tuplesort, EXPLAIN costs -- is reachable from an
+ * extension), but its output should be a starting point a human
+ * validates, which is why no pg_calibrate_costs() ships here.
+ *
  *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -1135,6 +1135,18 @@ create_join_plan(PlannerInfo *root, JoinPath *best_path)
  *		Check whether the Plan node created from a Path node is async-capable,
  *		and if so, mark the Plan node as such and return true, otherwise
  *		return false.
+ *
+ * Today only foreign scans (and trivial SubqueryScan/Projection wrappers
+ * over them) can run asynchronously.  It is tempting to mark plain scans of
+ * local partitions async-capable too, so that Append could interleave I/O
+ * across partitions the way it does across remote servers; that needs two
+ * pieces that don't exist yet.  First, a nonblocking variant of
+ * read_stream_next_buffer(), so a scan can report "would block" instead of
+ * waiting inside the AIO layer.  Second, something waitable for
+ * ExecAsyncConfigureWait() to register with the Append node's WaitEventSet:
+ * the AIO subsystem completes I/Os via io_uring or worker processes and
+ * exposes no per-stream file descriptor.  Until both exist, local scans
+ * must stay synchronous here.
  */
 static bool
 mark_async_capable_plan(Plan *plan, Path *path)
@@ -4534,6 +4546,23 @@ create_nestloop_plan(PlannerInfo *root,
 							  best_path->jpath.jointype,
 							  best_path->jpath.inner_unique);
 
+	/*
+	 * May the executor skip signaling an inner parameter change when the
+	 * next outer tuple supplies the same values?  Doing so lets the inner
+	 * subtree keep caches (hash tables, Memoize entries) across the
+	 * rescan, but replaying cached results is only transparent if nothing
+	 * in the query is volatile -- the same hazard get_memoize_path() vets
+	 * for its single inner rel, checked here over the whole parse tree
+	 * since a nestloop inner can be arbitrarily complex.  Subplans'
+	 * bodies are no longer visible in the parse tree by this point, so
+	 * their presence disqualifies too.  This is deliberately more
+	 * conservative than strictly necessary.
+	 */
+	join_plan->paramCacheSafe =
+		(nestParams != NIL &&
+		 root->glob->subplans == NIL &&
+		 !contain_volatile_functions((Node *) root->parse));
+
 	copy_generic_path_info(&join_plan->join.plan, &best_path->jpath.path);
 
 	return join_plan;
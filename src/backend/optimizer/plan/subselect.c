@@ -1328,6 +1328,21 @@ convert_VALUES_to_ANY(PlannerInfo *root, Node *testexpr, Query *values)
  * Side effects of a successful conversion include adding the SubLink's
  * subselect to the query's rangetable, so that it can be referenced in
  * the JoinExpr's rarg.
+ *
+ * A note on the memory profile of the resulting semijoin: replacing the
+ * hash join with a bare "hashed set of join keys" (no tuple storage) is
+ * sometimes proposed for giant IN (SELECT ...) dedup checks.  In fact the
+ * hash table already stores little more than that: the inner side's
+ * targetlist is trimmed to the columns the join needs -- for a plain IN,
+ * exactly the key columns -- so each entry is the keys plus a
+ * MinimalTuple header.  The keys themselves can't be dropped, since hash
+ * equality must be rechecked on collisions.  What remains recoverable is
+ * the per-tuple header overhead, and semijoins additionally admit
+ * key-level deduplication at build time (storing each distinct key once
+ * regardless of inner duplicates) -- that build-side change in nodeHash.c
+ * would shrink heavily-duplicated inner sides without any new plan shape,
+ * and is where effort should go rather than into a new probe structure
+ * here.
  */
 JoinExpr *
 convert_ANY_sublink_to_join(PlannerInfo *root, SubLink *sublink,
@@ -2891,6 +2891,21 @@ partitions_are_ordered(PartitionBoundInfo boundinfo, Bitmapset *live_parts)
  *
  * Checks if the new partition's bound overlaps any of the existing partitions
  * of parent.  Also performs additional checks as necessary per strategy.
+ *
+ * On declarative interval partitioning with background pre-creation (the
+ * fix for ingest racing CREATE PARTITION at midnight): the bound
+ * machinery here is the easy half, computing "the next interval" is
+ * trivial.  The server-side scheme needs an owner for the DDL -- a
+ * maintenance worker creating relations implies decisions about naming,
+ * tablespaces, ownership/ACLs, per-partition reloptions and indexes
+ * (cloned from the parent's template, but templates change), and its
+ * DDL must not deadlock against the application's own DDL on the same
+ * parent.  None of that is research, but all of it is policy, which is
+ * why the ecosystem solves it with scheduled jobs (pg_partman et al.)
+ * creating tomorrow's partition hours ahead -- off-peak, under an
+ * operator-owned policy.  An application stalling at midnight is
+ * creating partitions at use time instead of ahead of time; no server
+ * mechanism is required to stop doing that.
  */
 void
 check_new_partition_bound(char *relname, Relation parent,
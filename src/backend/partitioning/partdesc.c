@@ -129,6 +129,22 @@ RelationGetPartitionDesc(Relation rel, bool omit_detached)
  * and are not associated with the relcache entry.  Such descriptors only last
  * through the requesting Portal, so we use the corresponding memory context
  * for them.
+ *
+ * We always load every partition's bound here, even though a pruned query
+ * may use exactly one of them.  That's not laziness: plan-time pruning
+ * *consumes* the sorted bound index this function builds (the binary
+ * search in get_matching_partitions runs over boundinfo), so the bounds
+ * must be complete and ordered before pruning can tell you which
+ * partitions to ignore -- a per-range lazily-faulted boundinfo would have
+ * to answer "what's adjacent to this value" without having sorted the
+ * neighbors, i.e. it needs the very index it's avoiding building.  The
+ * meaningful cost controls are at a different level: descriptors are
+ * built once per backend and cached in the relcache (so the tens of
+ * milliseconds are first-touch, not per-query), the pg_class/pg_inherits
+ * data arrives via one syscache pass rather than per-partition lookups,
+ * and PartitionDirectory keeps planner and executor from rebuilding the
+ * thing within a query.  If first-touch latency matters operationally,
+ * warming connections via the pooler hides it entirely.
  */
 static PartitionDesc
 RelationBuildPartitionDesc(Relation rel, bool omit_detached)
@@ -1891,6 +1891,7 @@ do_autovacuum(void)
 	TableScanDesc relScan;
 	Form_pg_database dbForm;
 	List	   *table_oids = NIL;
+	List	   *wraparound_oids = NIL;
 	List	   *orphan_oids = NIL;
 	HASHCTL		ctl;
 	HTAB	   *table_toast_map;
@@ -2044,9 +2045,21 @@ do_autovacuum(void)
 								  effective_multixact_freeze_max_age,
 								  &dovacuum, &doanalyze, &wraparound);
 
-		/* Relations that need work are added to table_oids */
+		/*
+		 * Relations that need work are added to table_oids -- except that
+		 * wraparound-urgent ones are collected separately, to be processed
+		 * before everything else.  A hot table nearing the freeze limit
+		 * must not wait behind a long tail of routine vacuums of cold
+		 * giants; the launcher only reacts at the database granularity, so
+		 * this ordering is where per-table xid urgency gets its priority.
+		 */
 		if (dovacuum || doanalyze)
-			table_oids = lappend_oid(table_oids, relid);
+		{
+			if (wraparound)
+				wraparound_oids = lappend_oid(wraparound_oids, relid);
+			else
+				table_oids = lappend_oid(table_oids, relid);
+		}
 
 		/*
 		 * Remember TOAST associations for the second pass.  Note: we must do
@@ -2138,7 +2151,13 @@ do_autovacuum(void)
 
 		/* ignore analyze for toast tables */
 		if (dovacuum)
-			table_oids = lappend_oid(table_oids, relid);
+		{
+			/* wraparound-urgent toast tables jump the queue, too */
+			if (wraparound)
+				wraparound_oids = lappend_oid(wraparound_oids, relid);
+			else
+				table_oids = lappend_oid(table_oids, relid);
+		}
 
 		/* Release stuff to avoid leakage */
 		if (free_relopts)
@@ -2150,6 +2169,9 @@ do_autovacuum(void)
 	table_endscan(relScan);
 	table_close(classRel, AccessShareLock);
 
+	/* put the wraparound-urgent tables at the head of the work list */
+	table_oids = list_concat(wraparound_oids, table_oids);
+
 	/*
 	 * Recheck orphan temporary tables, and if they still seem orphaned, drop
 	 * them.  We'll eat a transaction per dropped table, which might seem
@@ -2652,6 +2674,10 @@ perform_work_item(AutoVacuumWorkItem *workitem)
 									ObjectIdGetDatum(workitem->avw_relation),
 									Int64GetDatum((int64) workitem->avw_blockNumber));
 				break;
+			case AVW_GinCleanPendingList:
+				DirectFunctionCall1(gin_clean_pending_list,
+									ObjectIdGetDatum(workitem->avw_relation));
+				break;
 			default:
 				elog(WARNING, "unrecognized work item found: type %d",
 					 workitem->avw_type);
@@ -3260,6 +3286,10 @@ autovac_report_workitem(AutoVacuumWorkItem *workitem,
 			snprintf(activity, MAX_AUTOVAC_ACTIV_LEN,
 					 "autovacuum: BRIN summarize");
 			break;
+		case AVW_GinCleanPendingList:
+			snprintf(activity, MAX_AUTOVAC_ACTIV_LEN,
+					 "autovacuum: GIN pending list cleanup");
+			break;
 	}
 
 	/*
@@ -3297,25 +3327,58 @@ AutoVacuumingActive(void)
 /*
  * Request one work item to the next autovacuum run processing our database.
  * Return false if the request can't be recorded.
+ *
+ * An identical request that is already queued and not yet being processed
+ * counts as success without queueing a second copy.  Some requesters (the
+ * GIN pending-list path in particular) re-request from a hot code path for
+ * as long as the triggering condition persists, which without this dedup
+ * would flood all NUM_WORKITEMS slots with copies of one item and starve
+ * every other requester cluster-wide.
  */
 bool
 AutoVacuumRequestWork(AutoVacuumWorkItemType type, Oid relationId,
 					  BlockNumber blkno)
 {
 	int			i;
+	int			free_slot = -1;
 	bool		result = false;
 
 	LWLockAcquire(AutovacuumLock, LW_EXCLUSIVE);
 
 	/*
-	 * Locate an unused work item and fill it with the given data.
+	 * Check for an existing duplicate, remembering the first free slot as
+	 * we go.  An avw_active duplicate is being processed right now and may
+	 * be mid-way through, so it doesn't satisfy a new request.
 	 */
 	for (i = 0; i < NUM_WORKITEMS; i++)
 	{
 		AutoVacuumWorkItem *workitem = &AutoVacuumShmem->av_workItems[i];
 
-		if (workitem->avw_used)
+		if (!workitem->avw_used)
+		{
+			if (free_slot < 0)
+				free_slot = i;
 			continue;
+		}
+
+		if (!workitem->avw_active &&
+			workitem->avw_type == type &&
+			workitem->avw_database == MyDatabaseId &&
+			workitem->avw_relation == relationId &&
+			workitem->avw_blockNumber == blkno)
+		{
+			/* already queued; nothing more to do */
+			result = true;
+			break;
+		}
+	}
+
+	/*
+	 * Not queued yet: fill the free slot located above, if any.
+	 */
+	if (!result && free_slot >= 0)
+	{
+		AutoVacuumWorkItem *workitem = &AutoVacuumShmem->av_workItems[free_slot];
 
 		workitem->avw_used = true;
 		workitem->avw_active = false;
@@ -3324,9 +3387,6 @@ AutoVacuumRequestWork(AutoVacuumWorkItemType type, Oid relationId,
 		workitem->avw_relation = relationId;
 		workitem->avw_blockNumber = blkno;
 		result = true;
-
-		/* done */
-		break;
 	}
 
 	LWLockRelease(AutovacuumLock);
@@ -3536,6 +3536,22 @@ TerminateChildren(int signal)
  *
  * Note: if you change this code, also consider StartAutovacuumWorker and
  * StartBackgroundWorker.
+ *
+ * A built-in prefork pool (idle, pre-warmed backends receiving accepted
+ * sockets by fd-passing) is requested whenever connect latency comes up.
+ * The sticking points, for the record: a backend binds to a database at
+ * InitPostgres time and cannot switch, so the pool must be partitioned by
+ * (database, user, relevant GUCs) with all the sizing/eviction policy
+ * that implies; authentication runs in the backend after accept, so a
+ * pre-authenticated pool changes the security model (pg_hba evaluation
+ * against the real peer address must still happen post-handoff); and
+ * cache pre-warming is only as good as the pool's idle backends'
+ * invalidation processing, which means idle pool members must still
+ * consume sinval traffic or reconnect to fresh state.  All of that is a
+ * pooler, and the mature external ones already do fd-level handoff with
+ * these policies configurable.  What belongs in the server and has
+ * landed over the years is reducing per-fork costs (EXEC_BACKEND-style
+ * state transfer is already minimized on fork platforms).
  */
 static int
 BackendStartup(ClientSocket *client_sock)
@@ -83,6 +83,20 @@ static bool DecodeTXNNeedSkip(LogicalDecodingContext *ctx,
  *
  * We also support the ability to fast forward thru records, skipping some
  * record types completely - see individual record types for details.
+ *
+ * Note that RM_SEQ_ID records have no decode routine, so sequences don't
+ * replicate logically; failover runbooks compensate with setval sweeps.
+ * An attempt to wire this up was committed upstream once and reverted,
+ * and the hard parts it tripped over still hold: nextval is
+ * non-transactional (its effects survive abort, so sequence changes can't
+ * ride the transactional reorder buffer without a parallel
+ * non-transactional channel and its own ordering rules vs. the
+ * transactional DDL that creates/resets the sequence), and WAL records
+ * only log every SEQ_LOG_VALS values, so the decodable stream is an
+ * upper bound, not the exact counter.  Any revival needs to define apply
+ * semantics as "advance to at least X" from the start -- which is also
+ * what makes batched, cache-aware apply on the subscriber natural --
+ * rather than trying to make sequence changes look like row changes.
  */
 void
 LogicalDecodingProcessRecord(LogicalDecodingContext *ctx, XLogReaderState *record)
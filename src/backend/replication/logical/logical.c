@@ -327,6 +327,26 @@ StartupDecodingContext(List *output_plugin_options,
  *
  * Returns an initialized decoding context after calling the output plugin's
  * startup function.
+ *
+ * About slot-restart catch-up cost (re-decoding from restart_lsn to
+ * confirmed_flush after a crash or disconnect): restart_lsn is not an
+ * arbitrary replay position, it is the oldest LSN whose transactions
+ * were still in-progress at the last confirmed point -- everything
+ * between it and confirmed_flush is WAL whose changes may belong to
+ * transactions that commit after confirmed_flush.  \"Checkpoint the
+ * reorderbuffer periodically\" so restarts skip that window means
+ * serializing every in-progress transaction's accumulated changes, the
+ * snapshot builder, and the invalidation state as one consistent cut --
+ * the big transactions' changes are already on disk (spill files), but
+ * reassociating them with a serialized builder state at an arbitrary
+ * LSN is precisely the hard consistency problem snapbuild solves only
+ * at running_xacts boundaries.  The operational levers for long
+ * catch-ups are truthfully upstream of this code: frequent
+ * confirmed_flush advancement (consumers acknowledging promptly),
+ * logical_decoding_work_mem high enough that spills (which are
+ * restart-reusable) cover the monsters, and avoiding serialization of
+ * catch-up by keeping long-running transactions short -- the same
+ * transaction that holds restart_lsn back holds your recovery time.
  */
 LogicalDecodingContext *
 CreateInitDecodingContext(const char *plugin,
@@ -493,6 +513,21 @@ CreateInitDecodingContext(const char *plugin,
  *
  * Returns an initialized decoding context after calling the output plugin's
  * startup function.
+ *
+ * Each slot runs its own full decoding pipeline; N slots on one database
+ * decode the same WAL N times.  A shared decode-once/fan-out-many cache
+ * keeps being proposed for that.  The obstacle is that a decoding stream
+ * is not slot-independent: what a transaction decodes *to* depends on the
+ * slot's snapshot state (its own consistent point and catalog xmin, hence
+ * which catalog row versions are used to interpret tuples), and slots at
+ * different positions are, in general, interpreting WAL under different
+ * historic catalogs.  Only slots created at the same consistent point and
+ * advanced in lockstep could safely share reorder buffer output, and
+ * lockstep advancement reintroduces the head-of-line blocking that
+ * separate slots exist to avoid.  The sharable layer is the WAL read
+ * itself (already served from WAL buffers / OS cache), while consumers
+ * who want decode-once semantics can fan out downstream of one slot with
+ * external tooling.
  */
 LogicalDecodingContext *
 CreateDecodingContext(XLogRecPtr start_lsn,
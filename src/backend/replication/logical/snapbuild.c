@@ -1234,6 +1234,22 @@ SnapBuildProcessRunningXacts(SnapBuild *builder, XLogRecPtr lsn, xl_running_xact
  *
  * Returns true if there is a point in performing internal maintenance/cleanup
  * using the xl_running_xacts record.
+ *
+ * Regarding the wait this function imposes on new slots (waiting for all
+ * transactions that were running at the initial running_xacts record to
+ * finish): serialized snapshots in pg_logical/snapshots do shortcut it --
+ * see SnapBuildRestore above, which any builder reaching the same LSN can
+ * reuse, regardless of which slot wrote it.  So on clusters with existing
+ * active slots, new slots generally piggyback already.  What a "proactive
+ * serialization" scheme would add is coverage for the no-active-slot case;
+ * but a snapshot can only be serialized by something doing decoding-style
+ * catalog tracking from a consistent point, so a standalone serializer is
+ * a hidden decoding process with a slot's costs (catalog xmin holdback,
+ * WAL retention) and none of its accounting -- the cure is worse than the
+ * wait.  What actually bounds slot-creation latency is the frequency of
+ * xl_running_xacts (LOG_SNAPSHOT_INTERVAL_MS in bgwriter.c) plus the
+ * longest-running write transaction; keeping transactions short does more
+ * than any machinery here could.
  */
 static bool
 SnapBuildFindSnapshot(SnapBuild *builder, XLogRecPtr lsn, xl_running_xacts *running)
@@ -3363,6 +3363,22 @@ apply_handle_truncate(StringInfo s)
 
 /*
  * Logical replication protocol message dispatcher.
+ *
+ * Ordinary (non-streamed) transactions are applied serially, in commit
+ * order, by this one worker.  Farm-out of independent small transactions
+ * to the parallel apply workers -- the scheme that would let a subscriber
+ * keep up with a 50k-TPS publisher -- has to answer more than key-level
+ * conflict detection: replica identity keys don't capture all
+ * dependencies (foreign keys, secondary unique indexes, and triggers
+ * create cross-transaction ordering the publisher's commit order
+ * resolved), deadlocks among out-of-order applies need detection plus
+ * re-ordering rather than error-out, and the reported flush/apply LSN
+ * must remain the largest *prefix-complete* position, not the largest
+ * applied one, or confirmed positions could be lost on restart.  The
+ * streamed-transaction parallel path sidesteps all of this because each
+ * streamed xact is still committed in commit order.  Those wanting
+ * throughput today should look at splitting tables across subscriptions,
+ * which shards apply the same way multiple slots shard decoding.
  */
 void
 apply_dispatch(StringInfo s)
@@ -143,6 +143,20 @@ static bool SyncRepQueueIsOrderedByLSN(int mode);
  * represents a commit record.  If it doesn't, then we wait only for the WAL
  * to be flushed if synchronous_commit is set to the higher level of
  * remote_apply, because only commit records provide apply feedback.
+ *
+ * Contention notes: the protocol is already batch-shaped on the release
+ * side -- a walsender that advances the synced LSN releases every queued
+ * waiter up to it in one SyncRepWakeQueue() sweep, and insertion keeps
+ * the queue LSN-sorted precisely so that sweep is a prefix walk, not a
+ * re-sort.  When SyncRepLock is hot at extreme commit rates, the cost is
+ * the per-commit enqueue, and the realistic relief is committing less
+ * often per unit of work (batching application commits) or moving
+ * low-value writes off the sync path: synchronous_commit is USERSET, so
+ * "SET LOCAL synchronous_commit = local" is the per-transaction relaxed
+ * mode sometimes requested as a new feature.  Replacing the queue with
+ * atomically-advertised LSNs and a separate releaser process would add a
+ * wakeup hop on the commit latency path to save a lock that, with the
+ * above, is rarely the limit.
  */
 void
 SyncRepWaitForLSN(XLogRecPtr lsn, bool commit)
@@ -3257,7 +3257,19 @@ XLogSendPhysical(void)
 	enlargeStringInfo(&output_message, nbytes);
 
 retry:
-	/* attempt to read WAL from WAL buffers first */
+
+	/*
+	 * Attempt to read WAL from WAL buffers first.  This is also what makes
+	 * physical fan-out to many standbys cheap: every caught-up walsender
+	 * serves from the same shared buffers lock-free, so N standbys don't
+	 * read WAL from disk N times.  Only senders that have fallen behind
+	 * wal_buffers drop to WALRead() below, and those hit the OS page cache
+	 * for recently written segments; a dedicated shared send-cache ring
+	 * between the two would duplicate that cache at this layer.  Laggards
+	 * far enough behind to miss the page cache too are retention-bound,
+	 * not read-bound, and sizing wal_buffers up is the supported lever for
+	 * widening the lock-free window.
+	 */
 	rbytes = WALReadFromBuffers(&output_message.data[output_message.len],
 								startptr, nbytes, xlogreader->seg.ws_tli);
 	output_message.len += rbytes;
@@ -3341,6 +3353,19 @@ retry:
 
 /*
  * Stream out logically decoded data.
+ *
+ * Read, decode and send run sequentially in this one process, and decode
+ * CPU is usually what caps a busy logical slot's throughput.  Pipelining
+ * the stages across threads is not an option in today's backend (the
+ * decoding stage is built on syscache/relcache lookups, resource owners
+ * and memory contexts, none of which are thread-safe), and splitting the
+ * stages across *processes* means shipping the reorder buffer between
+ * address spaces, which is the expensive part.  The levers that do exist:
+ * WAL read I/O can overlap decode via read-ahead (cheap, local), and
+ * multiple consumers naturally shard across slots, each getting its own
+ * walsender.  Single-slot decode parallelism is essentially the same
+ * problem as parallelizing the reorder buffer itself, and should be
+ * designed there, not here.
  */
 static void
 XLogSendLogical(void)
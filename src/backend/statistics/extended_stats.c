@@ -5,6 +5,23 @@
  *
  * Generic code supporting statistics objects created via CREATE STATISTICS.
  *
+ * All statistics objects are single-relation today.  Cross-relation
+ * statistics ("CREATE STATISTICS ... ON orders JOIN customers USING
+ * (region)"), the usual request for fixing correlated join misestimates,
+ * need more than this module: a catalog representation binding multiple
+ * relations (with dependency/invalidations when either changes), an
+ * ANALYZE that samples the *join result* -- which amounts to running a
+ * join over samples, with all the bias questions sampled joins carry --
+ * and a lookup path in the join selectivity code
+ * (eqjoinsel/clauselist_selectivity) that can match a clause to a stats
+ * object spanning both input rels, including through equivalence classes.
+ * The statistics kinds themselves (ndistinct, dependencies, MCV) would
+ * carry over.  Anyone starting this should begin with the catalog and
+ * matching problems, not the math; and note that for the specific
+ * pattern of a redundantly-stored column pair (orders.region =
+ * customers.region), declaring the dependency with a foreign key already
+ * lets the planner use get_foreign_key_join_selectivity(), which fixes a
+ * large fraction of the reported cases without any of the above.
  *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
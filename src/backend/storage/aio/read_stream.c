@@ -24,6 +24,22 @@
  * increased rapidly to try to benefit from I/O combining and concurrency.  It
  * is reduced gradually when cached blocks are streamed.
  *
+ * Streams are strictly backend-local: the blocks a stream reads come from
+ * its own consumer's future, which is the only access pattern a backend
+ * can predict reliably.  A cross-backend "prefetch advisory" service --
+ * backends publishing (relfilenumber, block range) observations into a
+ * shared ring, with a worker warming trending blocks ahead of follower
+ * queries -- is better layered on top of this facility than into it: the
+ * policy questions (what counts as trending, how much of shared_buffers a
+ * speculative warmer may claim, how stale an advisory may be before
+ * warming is waste) are workload judgments, and an extension can already
+ * implement the whole loop today with a background worker driving
+ * read_stream_begin_relation() over whatever advisory channel it likes --
+ * pg_prewarm's autoprewarm worker is a working skeleton of exactly that
+ * shape (shared state in, stream-driven warming out).  Core providing the
+ * mechanism (this file) and extensions providing the policy is the
+ * intended split.
+ *
  * The main data structure is a circular queue of buffers of size
  * max_pinned_buffers plus some extra space for technical reasons, ready to be
  * returned by read_stream_next_buffer().  Each buffer also has an optional
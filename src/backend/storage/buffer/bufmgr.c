@@ -62,6 +62,7 @@
 #include "storage/smgr.h"
 #include "storage/standby.h"
 #include "utils/memdebug.h"
+#include "utils/memutils.h"
 #include "utils/ps_status.h"
 #include "utils/rel.h"
 #include "utils/resowner.h"
@@ -80,6 +81,9 @@
 #define BUF_WRITTEN				0x01
 #define BUF_REUSABLE			0x02
 
+/* largest number of adjacent dirty pages combined into one checkpoint write */
+#define CKPT_WRITE_COMBINE_MAX	Min(32, MAX_IO_COMBINE_LIMIT)
+
 #define RELS_BSEARCH_THRESHOLD		20
 
 /*
@@ -520,6 +524,8 @@ static void BufferSync(int flags);
 static uint32 WaitBufHdrUnlocked(BufferDesc *buf);
 static int	SyncOneBuffer(int buf_id, bool skip_recently_used,
 						  WritebackContext *wb_context);
+static int	SyncBufferRun(const CkptSortItem *items, int nitems,
+						  int *num_written, WritebackContext *wb_context);
 static void WaitIO(BufferDesc *buf);
 static void AbortBufferIO(Buffer buffer);
 static void shared_buffer_write_error_callback(void *arg);
@@ -3066,6 +3072,23 @@ ReleaseAndReadBuffer(Buffer buffer,
  * taking the buffer header lock; instead update the state variable in loop of
  * CAS operations. Hopefully it's just a single CAS.
  *
+ * Regarding sharded ("per-CPU") pin counters for hot pages, the next idea
+ * after the CAS: the refcount shares its atomic word with flag bits and
+ * usage count, and that co-location is what lets pin, unpin, flag tests
+ * and header locking be one atomic op.  Splitting refcount into N
+ * distributed counters makes the *eviction* side read N lines with a
+ * consistency protocol (a counter being nonzero must reliably block
+ * eviction -- a race here is data corruption, not slowness), makes
+ * CleanVictimBuffer-style paths slower for every buffer to help only
+ * truly-hot ones, and needs a policy for which buffers get shards and
+ * when they decay.  The per-backend PrivateRefCount array already absorbs
+ * repeat pins locally, so the line ping-pong happens only on first
+ * pin/last unpin per backend-visit; actual hot-row contention profiles
+ * are dominated by the content-lock and tuple-update costs on such
+ * pages, with the header line a minor term.  If that ever changes, the
+ * shardable design to copy is the proc-array style "known fixed set of
+ * participants" counter, not a dynamic per-page registry.
+ *
  * Note that ResourceOwnerEnlarge() and ReservePrivateRefCountEntry()
  * must have been done already.
  *
@@ -3358,6 +3381,7 @@ BufferSync(int flags)
 	int			num_spaces;
 	int			num_processed;
 	int			num_written;
+	int			nconsumed;
 	CkptTsStatus *per_ts_stat = NULL;
 	Oid			last_tsid;
 	binaryheap *ts_heap;
@@ -3410,6 +3434,7 @@ BufferSync(int flags)
 			item = &CkptBufferIds[num_to_scan++];
 			item->buf_id = buf_id;
 			item->tsId = bufHdr->tag.spcOid;
+			item->dbId = bufHdr->tag.dbOid;
 			item->relNumber = BufTagGetRelNumber(&bufHdr->tag);
 			item->forkNum = BufTagGetForkNum(&bufHdr->tag);
 			item->blockNum = bufHdr->tag.blockNum;
@@ -3544,7 +3569,7 @@ BufferSync(int flags)
 
 		bufHdr = GetBufferDescriptor(buf_id);
 
-		num_processed++;
+		nconsumed = 1;
 
 		/*
 		 * We don't need to acquire the lock here, because we're only looking
@@ -3560,7 +3585,46 @@ BufferSync(int flags)
 		 */
 		if (pg_atomic_read_u32(&bufHdr->state) & BM_CHECKPOINT_NEEDED)
 		{
-			if (SyncOneBuffer(buf_id, false, &wb_context) & BUF_WRITTEN)
+			int			runlen = 1;
+
+			/*
+			 * The list is sorted, so to-be-checkpointed buffers covering
+			 * consecutive blocks of the same relation fork sit next to each
+			 * other (within this tablespace's portion).  Writing such a run
+			 * with one vectored write turns a checkpoint's worth of 8kB
+			 * I/Os into extent-sized ones.
+			 */
+			while (runlen < CKPT_WRITE_COMBINE_MAX &&
+				   ts_stat->num_scanned + runlen < ts_stat->num_to_scan)
+			{
+				const CkptSortItem *it = &CkptBufferIds[ts_stat->index + runlen];
+				const CkptSortItem *prev = &CkptBufferIds[ts_stat->index + runlen - 1];
+
+				if (it->dbId != prev->dbId ||
+					it->relNumber != prev->relNumber ||
+					it->forkNum != prev->forkNum ||
+					it->blockNum != prev->blockNum + 1)
+					break;
+				if (!(pg_atomic_read_u32(&GetBufferDescriptor(it->buf_id)->state) &
+					  BM_CHECKPOINT_NEEDED))
+					break;
+				runlen++;
+			}
+
+			if (runlen > 1)
+			{
+				int			run_written = 0;
+
+				nconsumed = SyncBufferRun(&CkptBufferIds[ts_stat->index],
+										  runlen, &run_written, &wb_context);
+				if (run_written > 0)
+				{
+					TRACE_POSTGRESQL_BUFFER_SYNC_WRITTEN(buf_id);
+					PendingCheckpointerStats.buffers_written += run_written;
+					num_written += run_written;
+				}
+			}
+			else if (SyncOneBuffer(buf_id, false, &wb_context) & BUF_WRITTEN)
 			{
 				TRACE_POSTGRESQL_BUFFER_SYNC_WRITTEN(buf_id);
 				PendingCheckpointerStats.buffers_written++;
@@ -3568,13 +3632,15 @@ BufferSync(int flags)
 			}
 		}
 
+		num_processed += nconsumed;
+
 		/*
 		 * Measure progress independent of actually having to flush the buffer
 		 * - otherwise writing become unbalanced.
 		 */
-		ts_stat->progress += ts_stat->progress_slice;
-		ts_stat->num_scanned++;
-		ts_stat->index++;
+		ts_stat->progress += ts_stat->progress_slice * nconsumed;
+		ts_stat->num_scanned += nconsumed;
+		ts_stat->index += nconsumed;
 
 		/* Have all the buffers from the tablespace been processed? */
 		if (ts_stat->num_scanned == ts_stat->num_to_scan)
@@ -3802,6 +3868,19 @@ BgBufferSync(WritebackContext *wb_context)
 	/* Scale the estimate by a GUC to allow more aggressive tuning. */
 	upcoming_alloc_est = (int) (smoothed_alloc * bgwriter_lru_multiplier);
 
+	/*
+	 * With direct I/O for data there is no kernel writeback running behind
+	 * us: a backend that takes a dirty buffer as its victim eats the full
+	 * device write latency itself, and the OS page cache can't absorb
+	 * bursts.  Compensate by cleaning at least twice as far ahead of the
+	 * clock sweep as the configured multiplier asks for, so allocation
+	 * mostly finds buffers we've already written.
+	 */
+	if (io_direct_flags & IO_DIRECT_DATA)
+		upcoming_alloc_est = Max(upcoming_alloc_est,
+								 (int) (smoothed_alloc * 2 *
+										Max(bgwriter_lru_multiplier, 2.0)));
+
 	/*
 	 * If recent_alloc remains at zero for many cycles, smoothed_alloc will
 	 * eventually underflow to zero, and the underflows produce annoying
@@ -3989,6 +4068,196 @@ SyncOneBuffer(int buf_id, bool skip_recently_used, WritebackContext *wb_context)
 	return result | BUF_WRITTEN;
 }
 
+/*
+ *		SyncBufferRun -- write out a run of adjacent dirty pages
+ *
+ * The items describe checkpoint-pending buffers whose pages the caller
+ * (BufferSync) found to be consecutive blocks of one relation fork.  We
+ * try to write them with a single vectored smgrwritev() call instead of
+ * one smgrwrite() per page.
+ *
+ * The run may have to be cut short: a buffer may have been replaced or
+ * cleaned since the checkpoint began, or its content lock or I/O flag may
+ * not be available immediately.  To stay deadlock-free we only ever block
+ * on the run's first buffer; for the rest we take the content lock and
+ * start the I/O conditionally and stop the run on failure.  Buffers past
+ * the cut are left for the caller to process in later iterations.
+ *
+ * Returns the number of items consumed (always at least 1); *num_written
+ * is incremented by the number of buffers actually written.
+ */
+static int
+SyncBufferRun(const CkptSortItem *items, int nitems,
+			  int *num_written, WritebackContext *wb_context)
+{
+	static char *staging = NULL;
+	BufferDesc *bufs[CKPT_WRITE_COMBINE_MAX];
+	const void *pages[CKPT_WRITE_COMBINE_MAX];
+	XLogRecPtr	max_recptr = InvalidXLogRecPtr;
+	ErrorContextCallback errcallback;
+	SMgrRelation reln;
+	instr_time	io_start;
+	int			nvalid = 0;
+	int			nconsumed;
+
+	Assert(nitems >= 1 && nitems <= CKPT_WRITE_COMBINE_MAX);
+
+	/* One-time allocation of the staging area for checksummed copies */
+	if (staging == NULL)
+		staging = MemoryContextAllocAligned(TopMemoryContext,
+											(Size) CKPT_WRITE_COMBINE_MAX * BLCKSZ,
+											PG_IO_ALIGN_SIZE, 0);
+
+	/*
+	 * Collect as many buffers of the run as we can pin, share-lock and mark
+	 * as I/O-in-progress without blocking (except on the first one).
+	 */
+	for (int i = 0; i < nitems; i++)
+	{
+		BufferDesc *bufHdr = GetBufferDescriptor(items[i].buf_id);
+		LWLock	   *content_lock = BufferDescriptorGetContentLock(bufHdr);
+		uint32		buf_state;
+
+		/* Make sure we can handle the pin */
+		ReservePrivateRefCountEntry();
+		ResourceOwnerEnlarge(CurrentResourceOwner);
+
+		buf_state = LockBufHdr(bufHdr);
+
+		/*
+		 * The buffer might have been written out and even replaced with
+		 * another page since BufferSync() built its list; then it's no
+		 * longer ours to write.  (See SyncOneBuffer about why no content
+		 * lock is needed for these checks.)
+		 */
+		if (!(buf_state & BM_VALID) || !(buf_state & BM_DIRTY) ||
+			bufHdr->tag.blockNum != items[i].blockNum ||
+			BufTagGetForkNum(&bufHdr->tag) != items[i].forkNum ||
+			bufHdr->tag.relNumber != items[i].relNumber ||
+			bufHdr->tag.dbOid != items[i].dbId ||
+			bufHdr->tag.spcOid != items[i].tsId)
+		{
+			UnlockBufHdr(bufHdr, buf_state);
+			if (i == 0)
+				return 1;		/* clean/replaced: consumed, nothing to do */
+			break;				/* write the prefix collected so far */
+		}
+
+		PinBuffer_Locked(bufHdr);
+
+		if (i == 0)
+			LWLockAcquire(content_lock, LW_SHARED);
+		else if (!LWLockConditionalAcquire(content_lock, LW_SHARED))
+		{
+			UnpinBuffer(bufHdr);
+			break;
+		}
+
+		/*
+		 * Get the I/O-in-progress right.  Blocking is only safe for the
+		 * first buffer; a "false" result means somebody else cleaned the
+		 * buffer (first buffer), or that we can't tell without waiting
+		 * (later buffers), so the run ends either way.
+		 */
+		if (!StartBufferIO(bufHdr, false, i > 0))
+		{
+			LWLockRelease(content_lock);
+			UnpinBuffer(bufHdr);
+			if (i == 0)
+				return 1;		/* already clean: consumed, nothing written */
+			break;
+		}
+
+		/* Record the page LSN and clear BM_JUST_DIRTIED, as FlushBuffer */
+		buf_state = LockBufHdr(bufHdr);
+		if (buf_state & BM_PERMANENT)
+		{
+			XLogRecPtr	recptr = BufferGetLSN(bufHdr);
+
+			if (recptr > max_recptr)
+				max_recptr = recptr;
+		}
+		buf_state &= ~BM_JUST_DIRTIED;
+		UnlockBufHdr(bufHdr, buf_state);
+
+		bufs[nvalid++] = bufHdr;
+	}
+
+	Assert(nvalid >= 1);
+	nconsumed = nvalid;
+
+	/*
+	 * Force XLOG flush up to the newest LSN among the run, implementing the
+	 * basic WAL-before-data rule for all of them at once.
+	 */
+	if (!XLogRecPtrIsInvalid(max_recptr))
+		XLogFlush(max_recptr);
+
+	/*
+	 * Set up error traceback support for ereport().  On a write failure the
+	 * callback reports the run's first buffer; the kernel doesn't tell us
+	 * which page of a vectored write failed anyway.
+	 */
+	errcallback.callback = shared_buffer_write_error_callback;
+	errcallback.arg = bufs[0];
+	errcallback.previous = error_context_stack;
+	error_context_stack = &errcallback;
+
+	reln = smgropen(BufTagGetRelFileLocator(&bufs[0]->tag),
+					INVALID_PROC_NUMBER);
+
+	/*
+	 * Copy the pages to private storage and checksum the copies; we hold
+	 * only shared locks, so hint bits could change underneath a checksum
+	 * computed in place.
+	 */
+	for (int i = 0; i < nvalid; i++)
+	{
+		char	   *dst = staging + (Size) i * BLCKSZ;
+
+		memcpy(dst, BufHdrGetBlock(bufs[i]), BLCKSZ);
+		PageSetChecksumInplace((Page) dst, bufs[i]->tag.blockNum);
+		pages[i] = dst;
+	}
+
+	io_start = pgstat_prepare_io_time(track_io_timing);
+
+	smgrwritev(reln, items[0].forkNum, items[0].blockNum,
+			   pages, nvalid, false);
+
+	/*
+	 * Only the checkpointer gets here, so the I/O context is always
+	 * IOCONTEXT_NORMAL; count one write of nvalid blocks.
+	 */
+	pgstat_count_io_op_time(IOOBJECT_RELATION, IOCONTEXT_NORMAL,
+							IOOP_WRITE, io_start, 1, (uint64) nvalid * BLCKSZ);
+
+	pgBufferUsage.shared_blks_written += nvalid;
+
+	for (int i = 0; i < nvalid; i++)
+	{
+		BufferDesc *bufHdr = bufs[i];
+		BufferTag	tag;
+
+		/* Mark clean (unless BM_JUST_DIRTIED got set) and end the I/O */
+		TerminateBufferIO(bufHdr, true, 0, true, false);
+
+		LWLockRelease(BufferDescriptorGetContentLock(bufHdr));
+
+		tag = bufHdr->tag;
+		UnpinBuffer(bufHdr);
+
+		ScheduleBufferTagForWriteback(wb_context, IOCONTEXT_NORMAL, &tag);
+	}
+
+	/* Pop the error context stack */
+	error_context_stack = errcallback.previous;
+
+	*num_written += nvalid;
+
+	return nconsumed;
+}
+
 /*
  *		AtEOXact_Buffers - clean up at end of transaction.
  *
@@ -6450,6 +6719,11 @@ ckpt_buforder_comparator(const CkptSortItem *a, const CkptSortItem *b)
 		return -1;
 	else if (a->tsId > b->tsId)
 		return 1;
+	/* compare database; relfilenumbers repeat across databases */
+	if (a->dbId < b->dbId)
+		return -1;
+	else if (a->dbId > b->dbId)
+		return 1;
 	/* compare relation */
 	if (a->relNumber < b->relNumber)
 		return -1;
@@ -20,16 +20,42 @@
 #include "storage/buf_internals.h"
 #include "storage/bufmgr.h"
 #include "storage/proc.h"
+#include "storage/procnumber.h"
 
 #define INT_ACCESS_ONCE(var)	((int)(*((volatile int *)&(var))))
 
+/*
+ * The freelist is split into this many independently-locked partitions, so
+ * that backends hammering the free lists (momentarily after startup, and
+ * whenever relations are dropped or shrunk) don't all serialize on a single
+ * spinlock, and so that a backend keeps coming back to the same partition,
+ * which tends to hand it buffers from the same region of the (possibly
+ * NUMA-spanning) buffer array.  A buffer always lives in the partition
+ * derived from its buf_id; a backend prefers the partition derived from its
+ * ProcNumber and falls back to stealing from the others only when its home
+ * partition is empty.
+ */
+#define NUM_FREELIST_PARTITIONS 8
+
+typedef struct
+{
+	slock_t		lock;			/* protects the fields below, and freeNext of
+								 * the buffers on this partition's list */
+	int			firstFreeBuffer;	/* Head of list of unused buffers */
+	int			lastFreeBuffer; /* Tail of list of unused buffers */
+
+	/*
+	 * NOTE: lastFreeBuffer is undefined when firstFreeBuffer is -1 (that is,
+	 * when the list is empty)
+	 */
+} BufferFreelistPartition;
 
 /*
  * The shared freelist control information.
  */
 typedef struct
 {
-	/* Spinlock: protects the values below */
+	/* Spinlock: protects the clock sweep and bgwriter fields below */
 	slock_t		buffer_strategy_lock;
 
 	/*
@@ -39,13 +65,8 @@ typedef struct
 	 */
 	pg_atomic_uint32 nextVictimBuffer;
 
-	int			firstFreeBuffer;	/* Head of list of unused buffers */
-	int			lastFreeBuffer; /* Tail of list of unused buffers */
-
-	/*
-	 * NOTE: lastFreeBuffer is undefined when firstFreeBuffer is -1 (that is,
-	 * when the list is empty)
-	 */
+	/* partitioned lists of unused buffers */
+	BufferFreelistPartition freelists[NUM_FREELIST_PARTITIONS];
 
 	/*
 	 * Statistics.  These counters should be wide enough that they can't
@@ -98,45 +119,67 @@ static BufferDesc *GetBufferFromRing(BufferAccessStrategy strategy,
 static void AddBufferToRing(BufferAccessStrategy strategy,
 							BufferDesc *buf);
 
+/*
+ * Number of clock-sweep positions a backend claims from the shared hand in
+ * one atomic operation.  Under replacement-heavy workloads (large sequential
+ * scans churning shared_buffers) each backend otherwise performs one
+ * fetch-add on nextVictimBuffer per examined buffer, and that cache line
+ * becomes the hottest in the server.  Claimed-but-unused positions are
+ * simply consumed by the same backend's later allocations, so the batch must
+ * stay small enough that the hand doesn't run visibly ahead of actual
+ * eviction; it must also be smaller than the minimum possible NBuffers (16)
+ * so a batch can't span two wraparounds.
+ */
+#define CLOCK_SWEEP_BATCH_SIZE	8
+
+/* clock-sweep positions claimed by this backend but not yet consumed */
+static uint32 clock_sweep_next;
+static int	clock_sweep_remaining = 0;
+
 /*
  * ClockSweepTick - Helper routine for StrategyGetBuffer()
  *
  * Move the clock hand one buffer ahead of its current position and return the
  * id of the buffer now under the hand.
+ *
+ * To amortize contention on nextVictimBuffer, the hand is advanced
+ * CLOCK_SWEEP_BATCH_SIZE positions at a time and the claimed range is
+ * consumed from backend-local state; concurrent backends interleave whole
+ * ranges rather than single positions, which is just as acceptable an
+ * examination order.
  */
 static inline uint32
 ClockSweepTick(void)
 {
 	uint32		victim;
 
-	/*
-	 * Atomically move hand ahead one buffer - if there's several processes
-	 * doing this, this can lead to buffers being returned slightly out of
-	 * apparent order.
-	 */
-	victim =
-		pg_atomic_fetch_add_u32(&StrategyControl->nextVictimBuffer, 1);
-
-	if (victim >= NBuffers)
+	if (clock_sweep_remaining == 0)
 	{
-		uint32		originalVictim = victim;
-
-		/* always wrap what we look up in BufferDescriptors */
-		victim = victim % NBuffers;
+		/*
+		 * Atomically move hand ahead one batch - if there's several
+		 * processes doing this, this can lead to buffers being returned
+		 * slightly out of apparent order.
+		 */
+		victim =
+			pg_atomic_fetch_add_u32(&StrategyControl->nextVictimBuffer,
+									CLOCK_SWEEP_BATCH_SIZE);
 
 		/*
-		 * If we're the one that just caused a wraparound, force
-		 * completePasses to be incremented while holding the spinlock. We
-		 * need the spinlock so StrategySyncStart() can return a consistent
-		 * value consisting of nextVictimBuffer and completePasses.
+		 * If our claimed range just caused (or landed exactly on) a
+		 * wraparound, force completePasses to be incremented while holding
+		 * the spinlock. We need the spinlock so StrategySyncStart() can
+		 * return a consistent value consisting of nextVictimBuffer and
+		 * completePasses.  A batch can cover at most one wraparound, since
+		 * CLOCK_SWEEP_BATCH_SIZE is less than the smallest valid NBuffers.
 		 */
-		if (victim == 0)
+		if (victim % NBuffers + CLOCK_SWEEP_BATCH_SIZE > NBuffers ||
+			(victim >= NBuffers && victim % NBuffers == 0))
 		{
 			uint32		expected;
 			uint32		wrapped;
 			bool		success = false;
 
-			expected = originalVictim + 1;
+			expected = victim + CLOCK_SWEEP_BATCH_SIZE;
 
 			while (!success)
 			{
@@ -159,7 +202,14 @@ ClockSweepTick(void)
 				SpinLockRelease(&StrategyControl->buffer_strategy_lock);
 			}
 		}
+
+		clock_sweep_next = victim;
+		clock_sweep_remaining = CLOCK_SWEEP_BATCH_SIZE;
 	}
+
+	victim = clock_sweep_next++ % NBuffers;
+	clock_sweep_remaining--;
+
 	return victim;
 }
 
@@ -174,10 +224,12 @@ ClockSweepTick(void)
 bool
 have_free_buffer(void)
 {
-	if (StrategyControl->firstFreeBuffer >= 0)
-		return true;
-	else
-		return false;
+	for (int i = 0; i < NUM_FREELIST_PARTITIONS; i++)
+	{
+		if (StrategyControl->freelists[i].firstFreeBuffer >= 0)
+			return true;
+	}
+	return false;
 }
 
 /*
@@ -257,39 +309,53 @@ StrategyGetBuffer(BufferAccessStrategy strategy, uint32 *buf_state, bool *from_r
 	 * put on the freelist but we don't see the store yet - but that's pretty
 	 * harmless, it'll just get used during the next buffer acquisition.
 	 *
-	 * If there's buffers on the freelist, acquire the spinlock to pop one
-	 * buffer of the freelist. Then check whether that buffer is usable and
+	 * We look at our home partition's list first and steal from the other
+	 * partitions only if it's empty; that keeps backends spread across the
+	 * partition locks and tends to hand a backend buffers from the same
+	 * region of the buffer array each time.
+	 *
+	 * If there's buffers on a freelist, acquire that partition's spinlock to
+	 * pop one buffer off it. Then check whether that buffer is usable and
 	 * repeat if not.
 	 *
 	 * Note that the freeNext fields are considered to be protected by the
-	 * buffer_strategy_lock not the individual buffer spinlocks, so it's OK to
-	 * manipulate them without holding the spinlock.
+	 * owning partition's lock, not the individual buffer spinlocks, so it's
+	 * OK to manipulate them without holding the buffer spinlock.
 	 */
-	if (StrategyControl->firstFreeBuffer >= 0)
+	for (int n = 0; n < NUM_FREELIST_PARTITIONS; n++)
 	{
+		BufferFreelistPartition *fl;
+
+		/* cast copes with MyProcNumber being INVALID_PROC_NUMBER (-1) */
+		fl = &StrategyControl->freelists[(uint32) (MyProcNumber + n) %
+										 NUM_FREELIST_PARTITIONS];
+
+		if (fl->firstFreeBuffer < 0)
+			continue;
+
 		while (true)
 		{
 			/* Acquire the spinlock to remove element from the freelist */
-			SpinLockAcquire(&StrategyControl->buffer_strategy_lock);
+			SpinLockAcquire(&fl->lock);
 
-			if (StrategyControl->firstFreeBuffer < 0)
+			if (fl->firstFreeBuffer < 0)
 			{
-				SpinLockRelease(&StrategyControl->buffer_strategy_lock);
+				SpinLockRelease(&fl->lock);
 				break;
 			}
 
-			buf = GetBufferDescriptor(StrategyControl->firstFreeBuffer);
+			buf = GetBufferDescriptor(fl->firstFreeBuffer);
 			Assert(buf->freeNext != FREENEXT_NOT_IN_LIST);
 
 			/* Unconditionally remove buffer from freelist */
-			StrategyControl->firstFreeBuffer = buf->freeNext;
+			fl->firstFreeBuffer = buf->freeNext;
 			buf->freeNext = FREENEXT_NOT_IN_LIST;
 
 			/*
 			 * Release the lock so someone else can access the freelist while
 			 * we check out this buffer.
 			 */
-			SpinLockRelease(&StrategyControl->buffer_strategy_lock);
+			SpinLockRelease(&fl->lock);
 
 			/*
 			 * If the buffer is pinned or has a nonzero usage_count, we cannot
@@ -362,7 +428,12 @@ StrategyGetBuffer(BufferAccessStrategy strategy, uint32 *buf_state, bool *from_r
 void
 StrategyFreeBuffer(BufferDesc *buf)
 {
-	SpinLockAcquire(&StrategyControl->buffer_strategy_lock);
+	BufferFreelistPartition *fl;
+
+	/* a buffer always returns to the partition its buf_id maps to */
+	fl = &StrategyControl->freelists[buf->buf_id % NUM_FREELIST_PARTITIONS];
+
+	SpinLockAcquire(&fl->lock);
 
 	/*
 	 * It is possible that we are told to put something in the freelist that
@@ -370,13 +441,13 @@ StrategyFreeBuffer(BufferDesc *buf)
 	 */
 	if (buf->freeNext == FREENEXT_NOT_IN_LIST)
 	{
-		buf->freeNext = StrategyControl->firstFreeBuffer;
+		buf->freeNext = fl->firstFreeBuffer;
 		if (buf->freeNext < 0)
-			StrategyControl->lastFreeBuffer = buf->buf_id;
-		StrategyControl->firstFreeBuffer = buf->buf_id;
+			fl->lastFreeBuffer = buf->buf_id;
+		fl->firstFreeBuffer = buf->buf_id;
 	}
 
-	SpinLockRelease(&StrategyControl->buffer_strategy_lock);
+	SpinLockRelease(&fl->lock);
 }
 
 /*
@@ -505,11 +576,28 @@ StrategyInitialize(bool init)
 		SpinLockInit(&StrategyControl->buffer_strategy_lock);
 
 		/*
-		 * Grab the whole linked list of free buffers for our strategy. We
-		 * assume it was previously set up by BufferManagerShmemInit().
+		 * Distribute all buffers across the freelist partitions, relinking
+		 * the freeNext chains that BufferManagerShmemInit() set up.  We walk
+		 * the buffers in reverse so that each partition's list ends up in
+		 * ascending buf_id order.
 		 */
-		StrategyControl->firstFreeBuffer = 0;
-		StrategyControl->lastFreeBuffer = NBuffers - 1;
+		for (int i = 0; i < NUM_FREELIST_PARTITIONS; i++)
+		{
+			SpinLockInit(&StrategyControl->freelists[i].lock);
+			StrategyControl->freelists[i].firstFreeBuffer = FREENEXT_END_OF_LIST;
+			StrategyControl->freelists[i].lastFreeBuffer = FREENEXT_END_OF_LIST;
+		}
+		for (int i = NBuffers - 1; i >= 0; i--)
+		{
+			BufferDesc *buf = GetBufferDescriptor(i);
+			BufferFreelistPartition *fl;
+
+			fl = &StrategyControl->freelists[i % NUM_FREELIST_PARTITIONS];
+			buf->freeNext = fl->firstFreeBuffer;
+			if (buf->freeNext < 0)
+				fl->lastFreeBuffer = i;
+			fl->firstFreeBuffer = i;
+		}
 
 		/* Initialize the clock sweep pointer */
 		pg_atomic_init_u32(&StrategyControl->nextVictimBuffer, 0);
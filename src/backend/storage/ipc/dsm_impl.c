@@ -66,9 +66,34 @@
 #include "postmaster/postmaster.h"
 #include "storage/dsm_impl.h"
 #include "storage/fd.h"
+#include "storage/pg_shmem.h"
 #include "utils/guc.h"
 #include "utils/memutils.h"
 
+/*
+ * Advise the kernel to back a just-created DSM mapping with huge pages.
+ *
+ * Explicit MAP_HUGETLB can't be used here: POSIX shm objects and files
+ * under pg_dynshmem aren't hugetlbfs-backed, and preallocated huge page
+ * pools don't suit segments that come and go with parallel queries anyway.
+ * Transparent huge pages, however, do apply to these mappings on Linux
+ * when shmem THP is enabled in "advise" mode, so ask for them via
+ * madvise(MADV_HUGEPAGE) unless huge pages are disabled outright.  Large
+ * DSA-backed allocations -- parallel hash join tables above all -- then
+ * get 2MB mappings and stop thrashing the TLB, while the hint is free
+ * where THP is unavailable.  Small segments aren't worth a syscall.
+ */
+#if defined(USE_DSM_POSIX) || defined(USE_DSM_MMAP)
+static void
+dsm_impl_advise_huge_pages(void *address, Size request_size)
+{
+#ifdef MADV_HUGEPAGE
+	if (huge_pages != HUGE_PAGES_OFF && request_size >= 2 * 1024 * 1024)
+		(void) madvise(address, request_size, MADV_HUGEPAGE);
+#endif
+}
+#endif
+
 #ifdef USE_DSM_POSIX
 static bool dsm_impl_posix(dsm_op op, dsm_handle handle, Size request_size,
 						   void **impl_private, void **mapped_address,
@@ -332,6 +357,7 @@ dsm_impl_posix(dsm_op op, dsm_handle handle, Size request_size,
 						name)));
 		return false;
 	}
+	dsm_impl_advise_huge_pages(address, request_size);
 	*mapped_address = address;
 	*mapped_size = request_size;
 	close(fd);
@@ -934,6 +960,7 @@ dsm_impl_mmap(dsm_op op, dsm_handle handle, Size request_size,
 						name)));
 		return false;
 	}
+	dsm_impl_advise_huge_pages(address, request_size);
 	*mapped_address = address;
 	*mapped_size = request_size;
 
@@ -268,6 +268,44 @@ typedef enum KAXCompressReason
 
 static ProcArrayStruct *procArray;
 
+/*
+ * Shared snapshot cache.
+ *
+ * GetSnapshotDataReuse() lets one backend skip rebuilding a snapshot its
+ * own previous call already computed; this structure extends the same
+ * invariant across backends.  Whoever computes a snapshot the hard way
+ * publishes its contents here, tagged with the xactCompletionCount it was
+ * built under, and any backend finding the current count in validCount can
+ * adopt the published snapshot instead of scanning the proc array --
+ * O(running xids copied) instead of O(connections scanned).
+ *
+ * Synchronization: both publishing and adoption happen while holding
+ * ProcArrayLock (shared suffices).  xactCompletionCount only advances
+ * under exclusive ProcArrayLock, so once validCount equals the current
+ * count, the contents are immutable for as long as any reader holds the
+ * lock; writers serialize among themselves with the "publishing" flag and
+ * simply skip publishing when they lose the race.  validCount is set only
+ * after the contents are fully written (with a write barrier between).
+ */
+typedef struct SharedSnapshotCache
+{
+	pg_atomic_uint32 publishing;	/* claim flag for writers */
+	pg_atomic_uint64 validCount;	/* xactCompletionCount of contents */
+	TransactionId xmin;
+	TransactionId xmax;
+	uint32		xcnt;			/* # of valid entries in xip part */
+	int32		subxcnt;		/* # of valid entries in subxip part */
+	bool		suboverflowed;
+	bool		takenDuringRecovery;
+
+	/* xip entries, then subxip entries, at subxipOffset */
+	TransactionId xids[FLEXIBLE_ARRAY_MEMBER];
+} SharedSnapshotCache;
+
+static SharedSnapshotCache *sharedSnapshotCache = NULL;
+
+#define SharedSnapshotCacheSubxip(cache) 	(&(cache)->xids[GetMaxSnapshotXidCount()])
+
 static PGPROC *allProcs;
 
 /*
@@ -406,6 +444,13 @@ ProcArrayShmemSize(void)
 						mul_size(sizeof(bool), TOTAL_MAX_CACHED_SUBXIDS));
 	}
 
+	/* Shared snapshot cache: header plus xip and subxip arrays */
+	size = add_size(size,
+					add_size(offsetof(SharedSnapshotCache, xids),
+							 mul_size(sizeof(TransactionId),
+									  add_size(PROCARRAY_MAXPROCS,
+											   TOTAL_MAX_CACHED_SUBXIDS))));
+
 	return size;
 }
 
@@ -444,6 +489,20 @@ ProcArrayShmemInit(void)
 
 	allProcs = ProcGlobal->allProcs;
 
+	/* Create or attach to the shared snapshot cache */
+	sharedSnapshotCache = (SharedSnapshotCache *)
+		ShmemInitStruct("Shared Snapshot Cache",
+						add_size(offsetof(SharedSnapshotCache, xids),
+								 mul_size(sizeof(TransactionId),
+										  add_size(PROCARRAY_MAXPROCS,
+												   TOTAL_MAX_CACHED_SUBXIDS))),
+						&found);
+	if (!found)
+	{
+		pg_atomic_init_u32(&sharedSnapshotCache->publishing, 0);
+		pg_atomic_init_u64(&sharedSnapshotCache->validCount, 0);
+	}
+
 	/* Create or attach to the KnownAssignedXids arrays too, if needed */
 	if (EnableHotStandby)
 	{
@@ -2079,6 +2138,102 @@ GetMaxSnapshotSubxidCount(void)
 	return TOTAL_MAX_CACHED_SUBXIDS;
 }
 
+/*
+ * Helper function for GetSnapshotData() that tries to adopt a snapshot
+ * another backend published for the current xactCompletionCount, instead
+ * of scanning the proc array.  Returns true and fills the snapshot (and
+ * the same caller-visible state GetSnapshotDataReuse() maintains) on a
+ * cache hit.
+ */
+static bool
+GetSnapshotDataFromSharedCache(Snapshot snapshot)
+{
+	SharedSnapshotCache *cache = sharedSnapshotCache;
+	uint64		curXactCompletionCount;
+
+	Assert(LWLockHeldByMe(ProcArrayLock));
+
+	curXactCompletionCount = TransamVariables->xactCompletionCount;
+	if (pg_atomic_read_u64(&cache->validCount) != curXactCompletionCount)
+		return false;
+	pg_read_barrier();
+
+	/*
+	 * The published contents match the current xactCompletionCount, and
+	 * the count cannot advance while we hold ProcArrayLock, so the
+	 * contents are stable for as long as we look at them (see the
+	 * SharedSnapshotCache comments).  Adopt them.
+	 */
+	snapshot->xmin = cache->xmin;
+	snapshot->xmax = cache->xmax;
+	snapshot->xcnt = cache->xcnt;
+	snapshot->subxcnt = cache->subxcnt;
+	snapshot->suboverflowed = cache->suboverflowed;
+	snapshot->takenDuringRecovery = cache->takenDuringRecovery;
+	memcpy(snapshot->xip, cache->xids,
+		   cache->xcnt * sizeof(TransactionId));
+	memcpy(snapshot->subxip, SharedSnapshotCacheSubxip(cache),
+		   cache->subxcnt * sizeof(TransactionId));
+	snapshot->snapXactCompletionCount = curXactCompletionCount;
+
+	/* now mirror what GetSnapshotDataReuse() does for the caller's state */
+	if (!TransactionIdIsValid(pg_atomic_read_u64(&MyProc->xmin)))
+		pg_atomic_write_u64(&MyProc->xmin, TransactionXmin = snapshot->xmin);
+
+	RecentXmin = snapshot->xmin;
+	Assert(TransactionIdPrecedesOrEquals(TransactionXmin, RecentXmin));
+
+	snapshot->curcid = GetCurrentCommandId(false);
+	snapshot->active_count = 0;
+	snapshot->regd_count = 0;
+	snapshot->copied = false;
+
+	return true;
+}
+
+/*
+ * PublishSnapshotToSharedCache
+ *		Make a freshly built snapshot adoptable by other backends.
+ *
+ * Caller must hold ProcArrayLock (shared is enough) and pass the
+ * xactCompletionCount the snapshot was built under.  If another backend is
+ * concurrently publishing, we just skip; it is publishing the same thing.
+ */
+static void
+PublishSnapshotToSharedCache(Snapshot snapshot, uint64 curXactCompletionCount,
+							 TransactionId xmin, TransactionId xmax,
+							 uint32 xcnt, int32 subxcnt, bool suboverflowed)
+{
+	SharedSnapshotCache *cache = sharedSnapshotCache;
+	uint32		expected = 0;
+
+	Assert(LWLockHeldByMe(ProcArrayLock));
+
+	if (pg_atomic_read_u64(&cache->validCount) == curXactCompletionCount)
+		return;					/* someone beat us to it */
+
+	if (!pg_atomic_compare_exchange_u32(&cache->publishing, &expected, 1))
+		return;					/* publisher active; don't wait */
+
+	if (pg_atomic_read_u64(&cache->validCount) != curXactCompletionCount)
+	{
+		cache->xmin = xmin;
+		cache->xmax = xmax;
+		cache->xcnt = xcnt;
+		cache->subxcnt = subxcnt;
+		cache->suboverflowed = suboverflowed;
+		cache->takenDuringRecovery = snapshot->takenDuringRecovery;
+		memcpy(cache->xids, snapshot->xip, xcnt * sizeof(TransactionId));
+		memcpy(SharedSnapshotCacheSubxip(cache), snapshot->subxip,
+			   subxcnt * sizeof(TransactionId));
+
+		pg_write_barrier();
+		pg_atomic_write_u64(&cache->validCount, curXactCompletionCount);
+	}
+
+	pg_atomic_write_u32(&cache->publishing, 0);
+}
+
 /*
  * Helper function for GetSnapshotData() that checks if the bulk of the
  * visibility information in the snapshot is still valid. If so, it updates
@@ -2233,6 +2388,13 @@ GetSnapshotData(Snapshot snapshot)
 		return snapshot;
 	}
 
+	/* likewise, try adopting a snapshot another backend just computed */
+	if (GetSnapshotDataFromSharedCache(snapshot))
+	{
+		LWLockRelease(ProcArrayLock);
+		return snapshot;
+	}
+
 	latest_completed = TransamVariables->latestCompletedXid;
 	mypgxactoff = MyProc->pgxactoff;
 	myxid = pg_atomic_read_u64(&other_xids[mypgxactoff]);
@@ -2410,6 +2572,23 @@ GetSnapshotData(Snapshot snapshot)
 	if (!TransactionIdIsValid(pg_atomic_read_u64(&MyProc->xmin)))
 		pg_atomic_write_u64(&MyProc->xmin, TransactionXmin = xmin);
 
+	/*
+	 * Let other backends adopt this snapshot instead of rebuilding it --
+	 * but only if it is not tailored to us.  The scan above deliberately
+	 * leaves our own xid (and therefore our subxids) out of the arrays,
+	 * which is correct for this backend only: our tuples are recognized by
+	 * TransactionIdIsCurrentTransactionId, not by the snapshot.  An
+	 * adopter has no such fallback, and since xactCompletionCount doesn't
+	 * advance until our xid completes, it could adopt the snapshot while
+	 * our transaction is still running and then see its effects the moment
+	 * it commits.  So publish only when we have no assigned xid (which
+	 * also implies no subxids).
+	 */
+	if (!TransactionIdIsValid(myxid))
+		PublishSnapshotToSharedCache(snapshot, curXactCompletionCount,
+									 xmin, xmax, count, subcount,
+									 suboverflowed);
+
 	LWLockRelease(ProcArrayLock);
 
 	/* maintain state for GlobalVis* */
@@ -51,6 +51,22 @@
  * also be read without holding the spinlock, as a quick preliminary check
  * when searching for a particular PID in the array.
  *
+ * Note that this design already is the "shared-memory doorbell array with
+ * batched processing" that gets proposed when procsignal shows up in
+ * profiles: reasons are flags set in shared memory, one SIGUSR1 per
+ * *notification* (not per reason) makes the target look at its slot, and
+ * the handler drains every pending flag in one pass.  The kill() syscall
+ * per target can't be batched away for correctness reasons -- a sleeping
+ * target must be woken, and a signal (or its latch equivalent, which is
+ * also a syscall) is the only wakeup the kernel offers -- but it is
+ * already skipped where it matters: barrier waits poll generations with
+ * condition variables, and senders coalesce naturally because an
+ * already-set flag needs no second signal to be observed.  When every
+ * backend must acknowledge a ProcSignalBarrier, the latency blips come
+ * from the *work* each backend does at its next interrupt check, not
+ * from syscall volume; shrinking the barrier processing, or emitting
+ * fewer barriers, is where improvements land.
+ *
  * pss_signalFlags are intended to be set in cases where we don't need to
  * keep track of whether or not the target process has handled the signal,
  * but sometimes we need confirmation, as when making a global state change
@@ -14,6 +14,21 @@
  * - postmaster death (WL_POSTMASTER_DEATH or WL_EXIT_ON_PM_DEATH)
  * - timeout (WL_TIMEOUT)
  *
+ * Each process owns its wait sets (and hence its epoll/kqueue fd).  A
+ * shared multiplexer -- one central wait set watching thousands of idle
+ * clients' sockets, run by a watcher pool that wakes the owning backend on
+ * activity -- is the standing proposal for making idle connections cheap.
+ * It can't be built at this layer: an fd registered in one process's epoll
+ * set refers to that process's descriptor, so a central watcher needs
+ * every client socket duplicated into it (SCM_RIGHTS passing at connect),
+ * and after wakeup the watcher can only set the owner's latch -- adding a
+ * context-switch hop to every wakeup on the latency path.  The state that
+ * makes an idle connection expensive isn't the epoll fd anyway; it's the
+ * whole process attached to it.  Solving that means detaching session
+ * state from processes (the pooler model, or someday built-in session
+ * pooling above the protocol layer), at which point the multiplexer falls
+ * out naturally on the pooler side, where it already exists today.
+ *
  * Implementation
  * --------------
  *
@@ -215,6 +215,23 @@ InitDeadLockChecking(void)
  * subsequent printing by DeadLockReport().  That activity is separate
  * because (a) we don't want to do it while holding all those LWLocks,
  * and (b) we are typically invoked inside a signal handler.
+ *
+ * Yes, holding every partition lock freezes the lock manager for the
+ * duration, and on heavily contended workloads that's a visible stall
+ * when a deadlock_timeout fires.  Maintaining the wait-for graph
+ * incrementally at block/grant time wouldn't shrink that critical
+ * section the way it sounds: the graph's edges include *soft* edges --
+ * orderings we could still choose by rearranging wait queues -- so cycle
+ * testing inherently explores alternative queue orders (see
+ * TestConfiguration/ExpandConstraints), not a static neighborhood; and
+ * any incremental structure would itself need maintenance under the
+ * partition locks on every block/grant, moving cost from the rare
+ * detector run to the hot path.  The practical levers are the ones the
+ * design already gives: deadlock_timeout high enough that checks run
+ * only when something is genuinely stuck (the timer is per-waiter and
+ * cheap), and application lock ordering so queues stay shallow.  Note
+ * the stall is bounded by graph size, not by backend count per se --
+ * idle backends contribute nothing.
  */
 DeadLockState
 DeadLockCheck(PGPROC *proc)
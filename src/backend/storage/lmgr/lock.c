@@ -198,6 +198,21 @@ static bool IsRelationExtensionLockHeld PG_USED_FOR_ASSERTS_ONLY = false;
  * We set the limit based on max_locks_per_transaction GUC, because that's
  * the best information about expected number of locks per backend we have.
  * See InitializeFastPathLocks() for details.
+ *
+ * So partitioned workloads that overflow the fast path should raise
+ * max_locks_per_transaction, which sizes these arrays -- the old fixed 16
+ * slots are history.  As for going further and making weak relation locks
+ * fully lock-free with per-relation atomics: the fast path is cheap but
+ * cannot be *lock-free*, because a backend acquiring a strong lock must
+ * be able to observe and transfer every backend's fast-path entries for
+ * that relation (see FastPathTransferRelationLocks), which requires a
+ * consistent read of other backends' slot arrays -- that's what the
+ * per-backend fpInfoLock provides, and the strong-lock counter handshake
+ * already keeps that lock out of the picture unless someone actually
+ * takes a conflicting strong lock.  What remains under fpInfoLock in the
+ * common case is brief and uncontended (it's a per-backend lock); when
+ * "LockManager" lwlock waits show up instead, that's the shared table,
+ * i.e. overflow -- again the sizing knob above.
  */
 int			FastPathLockGroupsPerBackend = 0;
 
@@ -178,6 +178,7 @@ static const char *const BuiltinTrancheNames[] = {
 	[LWTRANCHE_XACT_SLRU] = "XactSLRU",
 	[LWTRANCHE_PARALLEL_VACUUM_DSA] = "ParallelVacuumDSA",
 	[LWTRANCHE_AIO_URING_COMPLETION] = "AioUringCompletion",
+	[LWTRANCHE_LLVMJIT_CACHE] = "LLVMJitCache",
 };
 
 StaticAssertDecl(lengthof(BuiltinTrancheNames) ==
@@ -1175,6 +1176,23 @@ LWLockDequeueSelf(LWLock *lock)
  * was available immediately, false if we had to sleep.
  *
  * Side effect: cancel/die interrupts are held off until lock release.
+ *
+ * On adaptive spinning and MCS queues, which get proposed whenever convoys
+ * are measured on the hottest tranches: the acquire loop already retries
+ * the atomic once before queueing, and LWLocks protect critical sections
+ * whose hold times range from nanoseconds (buffer mapping) to full I/Os
+ * (WALWrite), so any fixed or "adaptive" spin budget is wrong for most of
+ * the tranches most of the time -- spinning while the holder does an
+ * fsync burns a core and, worse, delays the holder on saturated systems.
+ * The largest convoy contributors have instead been attacked by shrinking
+ * or splitting the critical sections themselves (buffer mapping
+ * partitions, WAL insert locks, the group-clear protocols in procarray),
+ * which removes the queue rather than reordering it.  MCS-style local
+ * spinning also conflicts with LWLockWaitForVar and the variable-update
+ * protocol WALInsert relies on, which wake specific waiters based on
+ * state, not queue position.  Per-tranche policy knobs would mostly offer
+ * new ways to misconfigure; better to report long waits (see
+ * log_lwlock_waits-style instrumentation proposals) and fix the sections.
  */
 bool
 LWLockAcquire(LWLock *lock, LWLockMode mode)
@@ -1528,6 +1528,26 @@ SummarizeOldestCommittedSxact(void)
  *		As with GetSerializableTransactionSnapshot (which this is a subroutine
  *		for), the passed-in Snapshot pointer should reference a static data
  *		area that can safely be passed to GetSnapshotData.
+ *
+ * Two SSI tuning ideas that route through here and deserve their
+ * standing analysis.  Precomputing safe snapshots in a background
+ * process, so DEFERRABLE doesn't block: a safe snapshot is a property
+ * of a *moment* (no concurrent read/write serializable transactions
+ * whose commits could create the dangerous structure), and such moments
+ * can't be manufactured in advance on a busy system -- a stashed "safe"
+ * snapshot ages into an ordinary stale snapshot the instant a new rw
+ * transaction starts, which is also why the wait here can be unbounded.
+ * What reduces the wait is fewer/shorter overlapping rw serializable
+ * transactions, not precomputation.  Adaptive lock-granularity
+ * promotion thresholds (tune page->relation promotion by observed
+ * false-positive aborts): the knob already exists statically
+ * (max_pred_locks_per_page / _per_relation); making it adaptive needs
+ * abort attribution -- knowing which aborts were false positives
+ * requires knowing the true serialization graph, which SSI
+ * deliberately over-approximates.  Absent that oracle, tune the GUCs
+ * from pg_stat_database_conflicts-style abort rates, and declare
+ * genuinely read-only work READ ONLY so it takes the existing
+ * safe-snapshot and SxactIsROSafe opt-outs.
  */
 static Snapshot
 GetSafeSnapshot(Snapshot origSnapshot)
@@ -271,6 +271,8 @@ smgropen(RelFileLocator rlocator, ProcNumber backend)
 	{
 		/* hash_search already filled in the lookup key */
 		reln->smgr_targblock = InvalidBlockNumber;
+		reln->smgr_reservedblock = InvalidBlockNumber;
+		reln->smgr_lastreservedblock = InvalidBlockNumber;
 		for (int i = 0; i <= MAX_FORKNUM; ++i)
 			reln->smgr_cached_nblocks[i] = InvalidBlockNumber;
 		reln->smgr_which = 0;	/* we only have md.c at present */
@@ -357,6 +359,8 @@ smgrrelease(SMgrRelation reln)
 		reln->smgr_cached_nblocks[forknum] = InvalidBlockNumber;
 	}
 	reln->smgr_targblock = InvalidBlockNumber;
+	reln->smgr_reservedblock = InvalidBlockNumber;
+	reln->smgr_lastreservedblock = InvalidBlockNumber;
 
 	RESUME_INTERRUPTS();
 }
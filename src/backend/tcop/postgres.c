@@ -1619,6 +1619,23 @@ exec_parse_message(const char *query_string,	/* string to execute */
  * exec_bind_message
  *
  * Process a "Bind" message to create a portal from a prepared statement
+ *
+ * A "portal-less" fast path for the dominant shape (named statement,
+ * unnamed portal, one Execute, autocommit) is a recurring idea for
+ * shaving point-read overhead.  Before attempting it, note what the
+ * portal actually carries: the unnamed portal is where the bound
+ * parameter values, result-format codes, and the executor's snapshot and
+ * resource bookkeeping live between Bind and Execute -- the protocol
+ * allows other messages between them (Describe-portal being routine), so
+ * those must exist as an addressable object no matter what it's called;
+ * and error cleanup paths identify executor state through the portal.
+ * The portal is also not where the time goes: CreatePortal is a hash
+ * insert and a memory context, while the measurable per-message costs
+ * are snapshot acquisition and the transaction start/commit machinery,
+ * which autocommit point reads pay by definition.  Past profiling-driven
+ * wins here have accordingly been inside the shared setup (plancache
+ * validation, parameter handling), which benefit every caller rather
+ * than a recognized special case with its own bug surface.
  */
 static void
 exec_bind_message(StringInfo input_message)
@@ -2102,6 +2119,23 @@ exec_bind_message(StringInfo input_message)
  * exec_execute_message
  *
  * Process an "Execute" message for a portal
+ *
+ * Pipelined statements are executed to completion one at a time, and the
+ * overlap that pipeline mode hides is network turnarounds, not server
+ * work.  Overlapping execution *within* the backend (start planning
+ * statement N+1 while N's results drain) founders on the definition of
+ * "complete": N may still error while draining (timeout, cancel, client
+ * gone), and pipeline semantics require N+1 to then be skipped, so N+1's
+ * side effects -- including planning-time effects like taking locks,
+ * building plans against a command counter that N is still advancing,
+ * and firing anything via catalog access -- must not have happened yet.
+ * One process also has one CurrentMemoryContext/resource owner stack to
+ * run on.  What CAN overlap safely already does: results stream to the
+ * socket as produced (printtup doesn't buffer the result set), the
+ * client parses while we execute, and the client's next messages sit in
+ * our receive buffer so there's no turnaround between statements.  The
+ * remaining serial part is genuine execution time, which no scheduling
+ * trick removes.
  */
 static void
 exec_execute_message(const char *portal_name, long max_rows)
@@ -4229,6 +4263,23 @@ PostgresSingleUserMain(int argc, char *argv[],
  *
  * NB: Single user mode specific setup should go to PostgresSingleUserMain()
  * if reasonably possible.
+ *
+ * This loop is also why an idle connection costs a whole backend, and
+ * where any "session hibernation" scheme (serialize idle session state,
+ * release the process, rebind on the next client byte) would have to
+ * cut in.  The hard inventory is what "session state" includes beyond
+ * the easily serialized GUCs and prepared-statement sources: temp
+ * tables are physical relations tied to this backend's proc number,
+ * held advisory locks and open WITH HOLD cursors are backend-resident,
+ * LISTEN registrations have queue positions, and the relcache/catcache
+ * contents -- the bulk of the memory -- are rebuilt, not restored, so a
+ * rebound session pays warmup again, which for pools of hot sessions is
+ * the cost that matters.  Sessions restricted enough to hibernate
+ * cheaply (no temp objects, no held locks/cursors/LISTEN) are exactly
+ * the sessions transaction-mode poolers already multiplex today without
+ * server changes.  The server-side piece with standalone value, shrinking
+ * what an idle-but-bound backend pins, is being chipped at separately
+ * (catcache bounds, snapshot-scan costs).
  * ----------------------------------------------------------------
  */
 void
@@ -2,6 +2,23 @@
  * backend_status.c
  *	  Backend status reporting infrastructure.
  *
+ * This module is the template people reach for when proposing a built-in
+ * sampling profiler (periodic backend stack capture into a
+ * pg_stat_profile view).  The sticking point is the sampling primitive:
+ * a C call stack can only be unwound from inside the target process at a
+ * *safe* point, and signal handlers aren't one (the handler may run
+ * mid-palloc with arbitrary locks held; unwinding and symbolizing there
+ * is exactly the class of hazard that makes in-server profilers crash
+ * the server they observe, and deferring to CHECK_FOR_INTERRUPTS yields
+ * interrupt-point profiles, not CPU profiles).  External samplers read
+ * the stack from *outside* the process, which is why perf/eBPF get this
+ * safely and why the operational answer is making those usable
+ * (debuginfo, frame pointers in builds) rather than reimplementing them
+ * behind SQL.  What this module does own -- and what extensions like
+ * pg_wait_sampling build on -- is the always-current activity/wait state
+ * that can be sampled from another backend with no target cooperation;
+ * that covers off-CPU analysis, which is most production mysteries.
+ *
  * Copyright (c) 2001-2025, PostgreSQL Global Development Group
  *
  *
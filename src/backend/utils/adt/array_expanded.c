@@ -45,6 +45,24 @@ static void copy_byval_expanded_array(ExpandedArrayHeader *eah,
  * type data across calls; if so, pass a metacache pointer, making sure that
  * metacache->element_type is initialized to InvalidOid before first call.
  * If no cross-call caching is required, pass NULL for metacache.
+ *
+ * The expand/flatten ping-pong that dominates plpgsql array-crunching
+ * profiles comes from ownership, not from any missing cache here: an
+ * expanded object has exactly one owner (see expandeddatum.c's R/W vs R/O
+ * pointer rules), so whenever a R/W datum would escape its owner -- be
+ * passed to a function that might scribble on it, stored into another
+ * variable, returned -- it must be flattened or re-expanded to keep
+ * value semantics.  Reference counting was considered when the expanded
+ * datum machinery went in and rejected: with multiple owners, any writer
+ * needs copy-on-write, and the bookkeeping to know when a write requires
+ * a copy is the same flatten/expand cost wearing a different hat, plus
+ * new lifetime bugs across savepoint rollback.  plpgsql already exploits
+ * the single-owner design where it's safe (assignments to array
+ * variables keep the expanded form; binary-compatible casts and
+ * support-function-aware subscripting operate in place).  The wins left
+ * are in marking more array functions as able to take R/O expanded input
+ * (support exists -- see pg_proc.prosupport consumers) rather than in
+ * changing the ownership model.
  */
 Datum
 expand_array(Datum arraydatum, MemoryContext parentcontext,
@@ -5349,6 +5349,18 @@ initArrayResultWithSize(Oid element_type, MemoryContext rcontext,
  *	dvalue/disnull represent the new Datum to append to the array
  *	element_type is the Datum's type (must be a valid array element type)
  *	rcontext is where to keep working state
+ *
+ * The accumulated state -- and hence a single array_agg() group -- must
+ * fit in memory.  Making it spillable isn't a matter of swapping in a
+ * tuplestore here: the aggregate's *result* is one contiguous varlena, so
+ * even a spilled transition state has to be reassembled whole at final
+ * time, and a result near or past 1GB fails at the varlena layer no
+ * matter how transition ran.  nodeAgg's hashagg spill machinery doesn't
+ * help either; it spills input tuples of not-yet-started groups, not
+ * oversized per-group state.  Whale-sized groups are better expressed
+ * with unnest-friendly representations the caller streams (ordered
+ * subqueries, or server-side cursors over the detail rows) than with an
+ * aggregate whose contract is "hand me everything as one value".
  */
 ArrayBuildState *
 accumArrayResult(ArrayBuildState *astate,
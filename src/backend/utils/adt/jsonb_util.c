@@ -400,6 +400,21 @@ findJsonbValueFromContainer(JsonbContainer *container, uint32 flags,
  * returned.
  *
  * 'res' can be passed in as NULL, in which case it's newly palloc'ed here.
+ *
+ * Although the binary search below only touches the JEntry array and the
+ * matching key/value bytes, the caller has normally already detoasted (and
+ * decompressed) the whole datum, which is where single-key extraction from
+ * megabyte documents actually spends its time.  The often-suggested fix of
+ * a fixed-offset key directory in the datum header, paired with TOAST
+ * slice fetches, is an on-disk format change whose benefit evaporates
+ * whenever the column is compressed -- pglz/LZ4 streams can't be entered
+ * at a key's offset (see detoast_attr_slice), and jsonb columns compress
+ * well, so realistic deployments hit the decompress-everything wall, not
+ * the find-the-key wall.  The effective mitigations with today's format
+ * are SET STORAGE EXTERNAL on the jsonb column (making slice fetches real
+ * and partial-key access proportional to what's read) and extracting hot
+ * scalar keys into generated columns or expression indexes so the big
+ * document isn't touched at all on the common path.
  */
 JsonbValue *
 getKeyJsonValueFromContainer(JsonbContainer *container,
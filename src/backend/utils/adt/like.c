@@ -145,11 +145,115 @@ SB_lower_char(unsigned char c, pg_locale_t locale)
 
 #include "like_match.c"
 
+/*
+ * Bytewise substring search helper for the fast paths below; leans on
+ * memchr, which every libc vectorizes.
+ */
+static bool
+text_contains_bytes(const char *s, int slen, const char *needle, int nlen)
+{
+	const char *last = s + slen - nlen;
+
+	if (nlen == 0)
+		return true;
+
+	while (s <= last)
+	{
+		const char *hit = memchr(s, needle[0], last - s + 1);
+
+		if (hit == NULL)
+			return false;
+		if (memcmp(hit, needle, nlen) == 0)
+			return true;
+		s = hit + 1;
+	}
+	return false;
+}
+
+/*
+ * Try to satisfy a LIKE match with plain byte operations.
+ *
+ * The overwhelmingly common patterns -- exact ("foo"), prefix ("foo%"),
+ * suffix ("%foo") and substring ("%foo%") -- need none of the recursive
+ * wildcard machinery in like_match.c; they're memcmp/memchr problems.
+ * That's only valid when bytes compare as themselves: the collation must
+ * be deterministic, and the encoding single-byte or UTF-8 (whose multibyte
+ * sequences are self-synchronizing, so a byte match of a valid needle
+ * can't straddle character boundaries; other multibyte server encodings
+ * could false-match across boundaries and must use the character-aware
+ * matcher).
+ *
+ * Returns true and sets *result if the pattern had one of the fast shapes;
+ * false means the caller must run the full matcher.
+ */
+static bool
+GenericMatchTextFast(const char *s, int slen, const char *p, int plen,
+					 pg_locale_t locale, int *result)
+{
+	int			nwild = 0;
+	bool		wild_first = false;
+	bool		wild_last = false;
+
+	if (!locale->deterministic)
+		return false;
+	if (pg_database_encoding_max_length() != 1 &&
+		GetDatabaseEncoding() != PG_UTF8)
+		return false;
+
+	/* classify the pattern; any '_' or escape disqualifies it */
+	for (int i = 0; i < plen; i++)
+	{
+		if (p[i] == '_' || p[i] == '\\')
+			return false;
+		if (p[i] == '%')
+		{
+			if (i == 0)
+				wild_first = true;
+			else if (i == plen - 1)
+				wild_last = true;
+			else
+				return false;	/* wildcard in the middle */
+			nwild++;
+		}
+	}
+
+	if (nwild == 0)
+	{
+		/* exact match */
+		*result = (slen == plen && memcmp(s, p, plen) == 0)
+			? LIKE_TRUE : LIKE_FALSE;
+	}
+	else if (nwild == 1 && wild_last)
+	{
+		/* prefix: "foo%" */
+		*result = (slen >= plen - 1 && memcmp(s, p, plen - 1) == 0)
+			? LIKE_TRUE : LIKE_FALSE;
+	}
+	else if (nwild == 1 && wild_first)
+	{
+		/* suffix: "%foo" */
+		*result = (slen >= plen - 1 &&
+				   memcmp(s + slen - (plen - 1), p + 1, plen - 1) == 0)
+			? LIKE_TRUE : LIKE_FALSE;
+	}
+	else if (nwild == 2 && wild_first && wild_last)
+	{
+		/* substring: "%foo%" */
+		*result = text_contains_bytes(s, slen, p + 1, plen - 2)
+			? LIKE_TRUE : LIKE_FALSE;
+	}
+	else
+		return false;
+
+	return true;
+}
+
 /* Generic for all cases not requiring inline case-folding */
 static inline int
 GenericMatchText(const char *s, int slen, const char *p, int plen, Oid collation)
 {
 	pg_locale_t locale;
+	int			fastresult;
 
 	if (!OidIsValid(collation))
 	{
@@ -165,6 +269,9 @@ GenericMatchText(const char *s, int slen, const char *p, int plen, Oid collation
 
 	locale = pg_newlocale_from_collation(collation);
 
+	if (GenericMatchTextFast(s, slen, p, plen, locale, &fastresult))
+		return fastresult;
+
 	if (pg_database_encoding_max_length() == 1)
 		return SB_MatchText(s, slen, p, plen, locale);
 	else if (GetDatabaseEncoding() == PG_UTF8)
@@ -4920,6 +4920,20 @@ typedef struct NumericAggState
 	int64		NaNcount;		/* count of NaN values */
 	int64		pInfcount;		/* count of +Inf values */
 	int64		nInfcount;		/* count of -Inf values */
+
+#ifdef HAVE_INT128
+
+	/*
+	 * Fast-lane accumulator for short inputs, used only when !calcSumX2.
+	 * Typical financial columns are a few NBASE digits wide; such values
+	 * are summed here as int128 counts of NBASE^-2 (1e-8) units, and the
+	 * running total is folded into sumX only when something needs to look
+	 * at sumX (or an oversized input shows up).  Inputs folded here are
+	 * counted in N and in the maxScale bookkeeping as usual.
+	 */
+	int128		fastSum;		/* total, in units of NBASE^-2 */
+	int64		fastN;			/* number of inputs folded into fastSum */
+#endif
 } NumericAggState;
 
 #define NA_TOTAL_COUNT(na) \
@@ -4966,6 +4980,67 @@ makeNumericAggStateCurrentContext(bool calcSumX2)
 	return state;
 }
 
+#ifdef HAVE_INT128
+/*
+ * Does this value qualify for NumericAggState's int128 fast lane?
+ * It must fit in units of NBASE^-2 with room to spare: no digit above
+ * NBASE^3 (so |value| < 10^16) and none below NBASE^-2.
+ */
+static inline bool
+numeric_fast_sum_ok(const NumericVar *var)
+{
+	return (var->ndigits <= 4 &&
+			var->weight <= 3 &&
+			var->weight - var->ndigits >= -3);
+}
+
+/*
+ * Convert a qualifying value to int128 NBASE^-2 units.
+ */
+static inline int128
+numeric_fast_sum_value(const NumericVar *var)
+{
+	int128		val = 0;
+	int			shift;
+
+	for (int i = 0; i < var->ndigits; i++)
+		val = val * NBASE + var->digits[i];
+	for (shift = var->weight - var->ndigits + 3; shift > 0; shift--)
+		val *= NBASE;
+
+	return (var->sign == NUMERIC_NEG) ? -val : val;
+}
+
+/*
+ * Fold the fast-lane total into sumX.  Must be called before anything
+ * reads, copies or serializes sumX.
+ */
+static void
+numeric_fast_sum_flush(NumericAggState *state)
+{
+	NumericVar	tmp;
+	MemoryContext old_context;
+
+	if (state->fastN == 0)
+		return;
+
+	init_var(&tmp);
+	int128_to_numericvar(state->fastSum, &tmp);
+	tmp.weight -= 2;			/* fastSum is in units of NBASE^-2 */
+	tmp.dscale = state->maxScale;
+
+	old_context = MemoryContextSwitchTo(state->agg_context);
+	accum_sum_add(&state->sumX, &tmp);
+	MemoryContextSwitchTo(old_context);
+
+	free_var(&tmp);
+	state->fastSum = 0;
+	state->fastN = 0;
+}
+#else
+#define numeric_fast_sum_flush(state)	((void) 0)
+#endif							/* HAVE_INT128 */
+
 /*
  * Accumulate a new input value for numeric aggregate functions.
  */
@@ -5003,6 +5078,24 @@ do_numeric_accum(NumericAggState *state, Numeric newval)
 	else if (X.dscale == state->maxScale)
 		state->maxScaleCount++;
 
+#ifdef HAVE_INT128
+	/* short values take the int128 fast lane */
+	if (!state->calcSumX2 && numeric_fast_sum_ok(&X))
+	{
+		state->fastSum += numeric_fast_sum_value(&X);
+		state->fastN++;
+		state->N++;
+
+		/*
+		 * Each input is below 10^24 in these units, so overflow would take
+		 * ~10^14 of them; flush long before that.
+		 */
+		if (state->fastN >= INT64CONST(1000000000000))
+			numeric_fast_sum_flush(state);
+		return;
+	}
+#endif
+
 	/* if we need X^2, calculate that in short-lived context */
 	if (state->calcSumX2)
 	{
@@ -5091,6 +5184,22 @@ do_numeric_discard(NumericAggState *state, Numeric newval)
 		}
 	}
 
+#ifdef HAVE_INT128
+	/*
+	 * Short values can be backed out through the fast lane too; the lanes
+	 * are purely additive, so it doesn't matter which one a value
+	 * originally went into.  Don't take this shortcut for the last
+	 * remaining input, so the regular path below can reset the sums.
+	 */
+	if (!state->calcSumX2 && state->N > 1 && numeric_fast_sum_ok(&X))
+	{
+		state->fastSum -= numeric_fast_sum_value(&X);
+		state->fastN++;			/* counts folds, not inputs */
+		state->N--;
+		return true;
+	}
+#endif
+
 	/* if we need X^2, calculate that in short-lived context */
 	if (state->calcSumX2)
 	{
@@ -5122,6 +5231,10 @@ do_numeric_discard(NumericAggState *state, Numeric newval)
 		accum_sum_reset(&state->sumX);
 		if (state->calcSumX2)
 			accum_sum_reset(&state->sumX2);
+#ifdef HAVE_INT128
+		state->fastSum = 0;
+		state->fastN = 0;
+#endif
 	}
 
 	MemoryContextSwitchTo(old_context);
@@ -5261,6 +5374,9 @@ numeric_avg_combine(PG_FUNCTION_ARGS)
 	if (state2 == NULL)
 		PG_RETURN_POINTER(state1);
 
+	/* fold state2's fast-lane total into its sumX before reading it */
+	numeric_fast_sum_flush(state2);
+
 	/* manually copy all fields from state2 to state1 */
 	if (state1 == NULL)
 	{
@@ -5330,6 +5446,9 @@ numeric_avg_serialize(PG_FUNCTION_ARGS)
 
 	state = (NumericAggState *) PG_GETARG_POINTER(0);
 
+	/* make sure sumX reflects any fast-lane accumulation */
+	numeric_fast_sum_flush(state);
+
 	init_var(&tmp_var);
 
 	pq_begintypsend(&buf);
@@ -5440,6 +5559,9 @@ numeric_serialize(PG_FUNCTION_ARGS)
 
 	state = (NumericAggState *) PG_GETARG_POINTER(0);
 
+	/* make sure sumX reflects any fast-lane accumulation */
+	numeric_fast_sum_flush(state);
+
 	init_var(&tmp_var);
 
 	pq_begintypsend(&buf);
@@ -6267,6 +6389,8 @@ numeric_avg(PG_FUNCTION_ARGS)
 
 	N_datum = NumericGetDatum(int64_to_numeric(state->N));
 
+	numeric_fast_sum_flush(state);
+
 	init_var(&sumX_var);
 	accum_sum_final(&state->sumX, &sumX_var);
 	sumX_datum = NumericGetDatum(make_result(&sumX_var));
@@ -6299,6 +6423,8 @@ numeric_sum(PG_FUNCTION_ARGS)
 	if (state->nInfcount > 0)
 		PG_RETURN_NUMERIC(make_result(&const_ninf));
 
+	numeric_fast_sum_flush(state);
+
 	init_var(&sumX_var);
 	accum_sum_final(&state->sumX, &sumX_var);
 	result = make_result(&sumX_var);
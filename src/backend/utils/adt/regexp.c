@@ -90,9 +90,23 @@ typedef struct regexp_matches_ctx
  * the cache as long as it's used at least once in every MAX_CACHED_RES uses.
  */
 
-/* this is the maximum number of cached regular expressions */
+/*
+ * This is the maximum number of cached regular expressions.  32 dated from
+ * when compiled regexes were considered bulky; rule-engine workloads
+ * cycling through a few hundred patterns thrash a cache that small and pay
+ * recompilation (vastly more than a list walk) on nearly every call, while
+ * at 128 entries the worst-case move-to-front walk is still trivial next
+ * to executing any regex.  A *shared* compiled-pattern cache would not
+ * help: compiled regexes are pointer-rich structures allocated in
+ * backend-local memory, so sharing means either flattening them (a
+ * serialization format for Spencer NFAs/DFAs that doesn't exist) or a
+ * shared allocator plus locking on a lookup that is currently free.  The
+ * DFA transition machinery in rege_dfa.c already amounts to lazy bytecode
+ * specialization; a further JIT tier belongs in the regex engine proper,
+ * not in this wrapper.
+ */
 #ifndef MAX_CACHED_RES
-#define MAX_CACHED_RES	32
+#define MAX_CACHED_RES	128
 #endif
 
 /* A parent memory context for regular expressions. */
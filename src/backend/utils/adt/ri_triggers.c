@@ -243,6 +243,25 @@ pg_noreturn static void ri_ReportViolation(const RI_ConstraintInfo *riinfo,
  * RI_FKey_check -
  *
  * Check foreign key existence (combined for INSERT and UPDATE).
+ *
+ * This fires once per modified row, and bulk loads into FK-heavy schemas
+ * feel every one of those SPI round trips.  The set-based alternative --
+ * coalesce a statement's queued check events per constraint into one
+ * anti-join against the PK table -- is the standing improvement plan
+ * with working patch history, and this trigger's statement-level
+ * batching via transition tables is the intended vehicle (the initial
+ * ADD CONSTRAINT validation already runs set-based; see
+ * RI_Initial_Check's single-query formulation, which is the model).
+ * What has kept it from landing: per-row error reporting (the violating
+ * row's values must appear in the error, so the anti-join must return
+ * offenders, not just a count), the interaction with MATCH
+ * PARTIAL/expression semantics across NULL combinations which the
+ * per-row plans encode case-by-case, and deadlock-risk changes from
+ * taking KEY SHARE locks in join order rather than modification order.
+ * Each is tractable; the locking-order one needs the most care.  Until
+ * then, the supported bulk pattern is load-then-ADD-CONSTRAINT (or
+ * DEFERRABLE constraints plus batched commits), which already gets the
+ * one-big-join plan via the initial-validation path.
  */
 static Datum
 RI_FKey_check(TriggerData *trigdata)
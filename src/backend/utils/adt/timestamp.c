@@ -159,6 +159,102 @@ anytimestamp_typmodout(bool istz, int32 typmod)
  *	 USER I/O ROUTINES														 *
  *****************************************************************************/
 
+/*
+ * Fast path for the rigid ISO-8601 form "YYYY-MM-DD[ T]HH:MM:SS[.ffffff]",
+ * which is what bulk loads overwhelmingly feed us; timestamp parsing is
+ * routinely the top CPU consumer in CSV ingest.  This form means the same
+ * thing under every DateStyle setting, so we can skip the general
+ * field-splitting machinery entirely.  Returns false (leaving *result
+ * untouched) on any deviation -- wrong separators, out-of-range
+ * components, trailing junk, more than 6 fractional digits -- in which
+ * case the caller runs the full parser, so behavior and error reporting
+ * for everything else are unchanged.
+ */
+static bool
+timestamp_in_fast(const char *str, Timestamp *result)
+{
+	const unsigned char *s = (const unsigned char *) str;
+	int			year,
+				month,
+				day,
+				hour,
+				min,
+				sec;
+	int32		fsec = 0;
+	static const int month_days[12] = {
+		31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31
+	};
+
+#define FAST_DIGIT(c)	((c) >= '0' && (c) <= '9')
+#define FAST_2DIG(p)	(((p)[0] - '0') * 10 + ((p)[1] - '0'))
+
+	if (!(FAST_DIGIT(s[0]) && FAST_DIGIT(s[1]) &&
+		  FAST_DIGIT(s[2]) && FAST_DIGIT(s[3]) &&
+		  s[4] == '-' &&
+		  FAST_DIGIT(s[5]) && FAST_DIGIT(s[6]) &&
+		  s[7] == '-' &&
+		  FAST_DIGIT(s[8]) && FAST_DIGIT(s[9]) &&
+		  (s[10] == ' ' || s[10] == 'T') &&
+		  FAST_DIGIT(s[11]) && FAST_DIGIT(s[12]) &&
+		  s[13] == ':' &&
+		  FAST_DIGIT(s[14]) && FAST_DIGIT(s[15]) &&
+		  s[16] == ':' &&
+		  FAST_DIGIT(s[17]) && FAST_DIGIT(s[18])))
+		return false;
+
+	year = FAST_2DIG(s) * 100 + FAST_2DIG(s + 2);
+	month = FAST_2DIG(s + 5);
+	day = FAST_2DIG(s + 8);
+	hour = FAST_2DIG(s + 11);
+	min = FAST_2DIG(s + 14);
+	sec = FAST_2DIG(s + 17);
+
+	if (year == 0 ||
+		month < 1 || month > 12 ||
+		day < 1 || day > month_days[month - 1] ||
+		hour > 23 || min > 59 || sec > 59)
+		return false;
+	/* be precise about February 29 */
+	if (month == 2 && day == 29 &&
+		!(year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)))
+		return false;
+
+	s += 19;
+	if (*s == '.')
+	{
+		int			ndigits = 0;
+		int32		frac = 0;
+
+		s++;
+		while (FAST_DIGIT(*s) && ndigits < 6)
+		{
+			frac = frac * 10 + (*s - '0');
+			ndigits++;
+			s++;
+		}
+		if (ndigits == 0 || FAST_DIGIT(*s))
+			return false;		/* ".", or more precision than we store */
+		while (ndigits++ < 6)
+			frac *= 10;
+		fsec = frac;
+	}
+	if (*s != '\0')
+		return false;			/* timezone suffix or trailing junk */
+
+	*result = (date2j(year, month, day) - POSTGRES_EPOCH_JDATE) *
+		USECS_PER_DAY +
+		hour * USECS_PER_HOUR + min * USECS_PER_MINUTE + sec * USECS_PER_SEC +
+		fsec;
+
+	if (!IS_VALID_TIMESTAMP(*result))
+		return false;
+
+	return true;
+
+#undef FAST_DIGIT
+#undef FAST_2DIG
+}
+
 /* timestamp_in()
  * Convert a string to internal form.
  */
@@ -184,6 +280,13 @@ timestamp_in(PG_FUNCTION_ARGS)
 	char		workbuf[MAXDATELEN + MAXDATEFIELDS];
 	DateTimeErrorExtra extra;
 
+	/* rigid ISO-8601 input takes the fast lane */
+	if (timestamp_in_fast(str, &result))
+	{
+		AdjustTimestampForTypmod(&result, typmod, escontext);
+		PG_RETURN_TIMESTAMP(result);
+	}
+
 	dterr = ParseDateTime(str, workbuf, sizeof(workbuf),
 						  field, ftype, MAXDATEFIELDS, &nf);
 	if (dterr == 0)
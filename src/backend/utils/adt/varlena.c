@@ -1875,6 +1875,21 @@ namefastcmp_locale(Datum x, Datum y, SortSupport ssup)
 
 /*
  * sortsupport comparison func for locale cases
+ *
+ * Each comparison pair costs a strcoll-family call, so an ICU sort makes
+ * O(n log n) collation calls.  Full sort-key materialization (transform
+ * every tuple once with pg_strnxfrm, sort with memcmp) keeps being
+ * suggested; what we do instead is the abbreviated-key scheme: the first 8
+ * sort-key bytes ride along as datum1 and resolve the vast majority of
+ * comparisons with one machine compare, while full keys are generated
+ * only when abbreviations tie -- and abbreviation self-disables (via the
+ * abort logic below) when the data would make it useless.  Materializing
+ * complete keys differs from that only in storing the *rest* of the key
+ * too, which for ICU costs ~2-4x the string's size in memory per tuple --
+ * shrinking work_mem capacity and forcing earlier spills, which is why it
+ * lost in past measurements except on pathological common-prefix data.
+ * If such data is the workload, COLLATE "C" on the index/sort expression,
+ * or a stored strxfrm'd shadow column, buys the memcmp sort explicitly.
  */
 static int
 varstrfastcmp_locale(char *a1p, int len1, char *a2p, int len2, SortSupport ssup)
@@ -1975,6 +1990,21 @@ varstrfastcmp_locale(char *a1p, int len1, char *a2p, int len2, SortSupport ssup)
  * of a strxfrm() blob into a Datum (on little-endian machines, the 8 bytes are
  * stored in reverse order), and treat it as an unsigned integer.  When the "C"
  * locale is used, or in case of bytea, just memcpy() from original instead.
+ *
+ * Abbreviation applies only to a sort's leading key, which is why
+ * ORDER BY (country, city, name) degrades to authoritative comparisons as
+ * soon as the country abbreviations tie.  "Cascading" abbreviations for
+ * later keys is not this module's call: the per-column machinery here
+ * produces an abbreviation whenever sortsupport asks, but tuplesort's
+ * SortTuple carries exactly one datum1 slot, and the comparators
+ * (comparetup_heap and friends) are built around leading-key-then-fallback.
+ * Widening SortTuple for more cached abbreviations trades memory per tuple
+ * (and therefore work_mem capacity and cache footprint) against saved
+ * comparisons for all sorts, including the majority that never tie on the
+ * first key; past experiments along those lines have not shown a winning
+ * trade.  The targeted fix for low-cardinality leading columns is to sort
+ * on fewer keys: a (country, city, name) btree index, or GROUP BY-driven
+ * paths that split the sort, avoid re-comparing the leading column at all.
  */
 static Datum
 varstr_abbrev_convert(Datum original, SortSupport ssup)
@@ -551,8 +551,11 @@ CatCacheRemoveCTup(CatCache *cache, CatCTup *ct)
 	 * point into tuple, allocated together with the CatCTup.
 	 */
 	if (ct->negative)
+	{
 		CatCacheFreeKeys(cache->cc_tupdesc, cache->cc_nkeys,
 						 cache->cc_keyno, ct->keys);
+		--cache->cc_nnegtup;
+	}
 
 	pfree(ct);
 
@@ -560,6 +563,47 @@ CatCacheRemoveCTup(CatCache *cache, CatCTup *ct)
 	--CacheHdr->ch_ntup;
 }
 
+/*
+ * How many negative entries one catcache may accumulate before we prune.
+ *
+ * Negative entries are what protect repeated lookups of nonexistent
+ * objects (unqualified-name resolution walking a long search_path is the
+ * classic generator), but nothing ever removes them short of relevant DDL,
+ * so a workload probing many distinct missing names grows caches without
+ * bound.  When a cache blows past this ceiling we sweep it and drop
+ * unpinned negative entries until we're at half the ceiling; positive
+ * entries are never touched.  The specific value is a generous multiple of
+ * any sane search_path-miss working set.
+ */
+#define CATCACHE_MAX_NEG_ENTRIES	4096
+
+/*
+ * Prune unpinned negative entries, sparing "keepct", until the count is
+ * down to half the ceiling.
+ */
+static void
+CatCachePruneNegEntries(CatCache *cache, CatCTup *keepct)
+{
+	for (int i = 0; i < cache->cc_nbuckets; i++)
+	{
+		dlist_mutable_iter iter;
+
+		dlist_foreach_modify(iter, &cache->cc_bucket[i])
+		{
+			CatCTup    *ct = dlist_container(CatCTup, cache_elem, iter.cur);
+
+			if (!ct->negative || ct == keepct ||
+				ct->refcount != 0 || ct->dead || ct->c_list != NULL)
+				continue;
+
+			CatCacheRemoveCTup(cache, ct);
+
+			if (cache->cc_nnegtup <= CATCACHE_MAX_NEG_ENTRIES / 2)
+				return;
+		}
+	}
+}
+
 /*
  *		CatCacheRemoveCList
  *
@@ -950,6 +994,7 @@ InitCatCache(int id,
 	cp->cc_relisshared = false; /* temporary */
 	cp->cc_tupdesc = (TupleDesc) NULL;
 	cp->cc_ntup = 0;
+	cp->cc_nnegtup = 0;
 	cp->cc_nlist = 0;
 	cp->cc_nbuckets = nbuckets;
 	cp->cc_nlbuckets = 0;
@@ -2266,6 +2311,14 @@ CatalogCacheCreateEntry(CatCache *cache, HeapTuple ntp, Datum *arguments,
 	cache->cc_ntup++;
 	CacheHdr->ch_ntup++;
 
+	/*
+	 * Negative entries are bounded; prune when this cache accumulates too
+	 * many (see CatCachePruneNegEntries).
+	 */
+	if (ct->negative &&
+		++cache->cc_nnegtup > CATCACHE_MAX_NEG_ENTRIES)
+		CatCachePruneNegEntries(cache, ct);
+
 	/*
 	 * If the hash table has become too full, enlarge the buckets array. Quite
 	 * arbitrarily, we enlarge when fill factor > 2.
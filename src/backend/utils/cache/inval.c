@@ -307,6 +307,48 @@ static int	relsync_callback_count = 0;
  * ----------------------------------------------------------------
  */
 
+/*
+ * Do two invalidation messages say the same thing?
+ *
+ * Compared field by field rather than by memcmp, since the union can
+ * contain padding bytes of indeterminate content.
+ */
+static bool
+InvalMessagesEqual(const SharedInvalidationMessage *a,
+				   const SharedInvalidationMessage *b)
+{
+	if (a->id != b->id)
+		return false;
+
+	if (a->id >= 0)
+		return (a->cc.dbId == b->cc.dbId &&
+				a->cc.hashValue == b->cc.hashValue);
+
+	switch (a->id)
+	{
+		case SHAREDINVALCATALOG_ID:
+			return (a->cat.dbId == b->cat.dbId &&
+					a->cat.catId == b->cat.catId);
+		case SHAREDINVALRELCACHE_ID:
+			return (a->rc.dbId == b->rc.dbId &&
+					a->rc.relId == b->rc.relId);
+		case SHAREDINVALSMGR_ID:
+			return (a->sm.backend_hi == b->sm.backend_hi &&
+					a->sm.backend_lo == b->sm.backend_lo &&
+					RelFileLocatorEquals(a->sm.rlocator, b->sm.rlocator));
+		case SHAREDINVALRELMAP_ID:
+			return (a->rm.dbId == b->rm.dbId);
+		case SHAREDINVALSNAPSHOT_ID:
+			return (a->sn.dbId == b->sn.dbId &&
+					a->sn.relId == b->sn.relId);
+		case SHAREDINVALRELSYNC_ID:
+			return (a->rs.dbId == b->rs.dbId &&
+					a->rs.relid == b->rs.relid);
+	}
+
+	return false;
+}
+
 /*
  * AddInvalidationMessage
  *		Add an invalidation message to a (sub)group.
@@ -323,6 +365,19 @@ AddInvalidationMessage(InvalidationMsgsGroup *group, int subgroup,
 	InvalMessageArray *ima = &InvalMessageArrays[subgroup];
 	int			nextindex = group->nextmsg[subgroup];
 
+	/*
+	 * Skip exact repeats of the message we just queued in this subgroup.
+	 * Repeated catalog updates of the same row within one command (common
+	 * during DDL bursts) otherwise queue long runs of identical messages,
+	 * growing these arrays and, worse, the shared sinval queue every other
+	 * backend has to chew through.  Only the immediately preceding message
+	 * is checked -- this is a cheap filter for runs, not a full dedup --
+	 * so ordering of the surviving messages is unaffected.
+	 */
+	if (nextindex > group->firstmsg[subgroup] &&
+		InvalMessagesEqual(&ima->msgs[nextindex - 1], msg))
+		return;
+
 	if (nextindex >= ima->maxmsgs)
 	{
 		if (ima->msgs == NULL)
@@ -43,6 +43,22 @@
  * bare-bones; it's the caller's responsibility to build a new expression
  * if the old one gets invalidated.
  *
+ * All of this is deliberately backend-local.  A shared, queryId-keyed plan
+ * cache (so a fleet of connections doesn't re-plan the same hot statements
+ * after every deploy) founders on two things.  First, correctness of the
+ * cache key: a plan is valid only for a specific search_path, role + RLS
+ * environment, GUC settings that affect planning, and temp-schema
+ * contents, so "same queryId" is nowhere near "same plan"; every one of
+ * those would have to be part of the shared key, and a miss on any
+ * dimension silently yields wrong answers, not just bad performance.
+ * Second, representation: plans are pointer-rich node trees, so sharing
+ * means flattening through outfuncs/readfuncs per copy-out (as parallel
+ * query does), at which point much of the planning savings is spent on
+ * deserialization, while the invalidation traffic below would have to be
+ * rebroadcast to a shared structure with its own locking.  Connection
+ * pooling plus prepared statements achieves the intended effect with the
+ * machinery that exists.
+ *
  *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -240,6 +256,8 @@ CreateCachedPlan(RawStmt *raw_parse_tree,
 	plansource->generation = 0;
 	plansource->generic_cost = -1;
 	plansource->total_custom_cost = 0;
+	plansource->min_custom_cost = -1;
+	plansource->max_custom_cost = -1;
 	plansource->num_generic_plans = 0;
 	plansource->num_custom_plans = 0;
 
@@ -339,6 +357,8 @@ CreateOneShotCachedPlan(RawStmt *raw_parse_tree,
 	plansource->generation = 0;
 	plansource->generic_cost = -1;
 	plansource->total_custom_cost = 0;
+	plansource->min_custom_cost = -1;
+	plansource->max_custom_cost = -1;
 	plansource->num_generic_plans = 0;
 	plansource->num_custom_plans = 0;
 
@@ -1186,6 +1206,22 @@ choose_custom_plan(CachedPlanSource *plansource, ParamListInfo boundParams)
 	if (plansource->num_custom_plans < 5)
 		return true;
 
+	/*
+	 * If the custom plans' costs have varied wildly, the statement is
+	 * parameter-sensitive: some parameter values select vastly more rows
+	 * than others (the classic skewed tenant_id), and a generic plan built
+	 * for "average" selectivities will be catastrophic for the heavy
+	 * values.  The generic plan's estimated cost is not even comparable to
+	 * these, since it was costed with different selectivity assumptions.
+	 * Keep custom-planning such statements; the wasted planning effort is
+	 * bounded, the wrong-plan downside is not.  The factor of 10 is
+	 * arbitrary but needs to exceed normal cost noise between parameter
+	 * values of similar selectivity.
+	 */
+	if (plansource->min_custom_cost > 0 &&
+		plansource->max_custom_cost > plansource->min_custom_cost * 10)
+		return true;
+
 	avg_custom_cost = plansource->total_custom_cost / plansource->num_custom_plans;
 
 	/*
@@ -1352,10 +1388,19 @@ GetCachedPlan(CachedPlanSource *plansource, ParamListInfo boundParams,
 
 	if (customplan)
 	{
+		double		custom_cost;
+
 		/* Build a custom plan */
 		plan = BuildCachedPlan(plansource, qlist, boundParams, queryEnv);
-		/* Accumulate total costs of custom plans */
-		plansource->total_custom_cost += cached_plan_cost(plan, true);
+
+		/* Accumulate total costs of custom plans, tracking the spread */
+		custom_cost = cached_plan_cost(plan, true);
+		plansource->total_custom_cost += custom_cost;
+		if (plansource->min_custom_cost < 0 ||
+			custom_cost < plansource->min_custom_cost)
+			plansource->min_custom_cost = custom_cost;
+		if (custom_cost > plansource->max_custom_cost)
+			plansource->max_custom_cost = custom_cost;
 
 		plansource->num_custom_plans++;
 	}
@@ -1722,6 +1767,8 @@ CopyCachedPlan(CachedPlanSource *plansource)
 	/* We may as well copy any acquired cost knowledge */
 	newsource->generic_cost = plansource->generic_cost;
 	newsource->total_custom_cost = plansource->total_custom_cost;
+	newsource->min_custom_cost = plansource->min_custom_cost;
+	newsource->max_custom_cost = plansource->max_custom_cost;
 	newsource->num_generic_plans = plansource->num_generic_plans;
 	newsource->num_custom_plans = plansource->num_custom_plans;
 
@@ -1054,6 +1054,22 @@ equalRSDesc(RowSecurityDesc *rsdesc1, RowSecurityDesc *rsdesc2)
  *		Returns NULL if no pg_class row could be found for the given relid
  *		(suggesting we are trying to access a just-deleted relation).
  *		Any other error is reported via elog.
+ *
+ * Every backend runs this for itself, which on huge multitenant schemas
+ * means per-connection megabytes of duplicated descriptors and a catalog
+ * scan storm at connect.  Moving the "immutable" parts (tupledescs, index
+ * lists, partition descriptors) into shared memory is the obvious wish,
+ * and also where the dragons are: almost nothing in a relcache entry is
+ * truly immutable (tupledescs change with ALTER TABLE, index lists with
+ * CREATE INDEX [CONCURRENTLY], rules/policies/options at whim), so a
+ * shared segment needs MVCC-ish versioning of entries plus cross-backend
+ * reference counting before sinval can safely free anything; entries hold
+ * pointers into backend-local caches (rd_att defaults, rd_indexprs etc.
+ * are parse trees allocated per backend); and DSM segments aren't mapped
+ * at a stable address, so every internal pointer would need flattening or
+ * relative addressing.  That's the actual project.  Meanwhile, the
+ * deployment-level relief for connect storms is connection pooling, which
+ * amortizes exactly the cost this function represents.
  */
 static Relation
 RelationBuildDesc(Oid targetRelId, bool insertIt)
@@ -2284,6 +2284,19 @@ push_old_value(struct config_generic *gconf, GucAction action)
 
 /*
  * Do GUC processing at main transaction start.
+ *
+ * This is deliberately just a nest-level store: GUC state is already
+ * copy-on-write in the sense the "snapshot versioning" proposals ask
+ * for.  No stack entries or allocations happen at BEGIN; a variable
+ * grows a stack entry only when something actually changes it
+ * (push_old_value, called from set-time paths), and transaction end
+ * walks guc_stack_list, which contains only the changed variables.  So
+ * a read-only transaction's BEGIN/COMMIT cost in this module is this
+ * assignment plus an empty-list check in AtEOXact_GUC.  Profiles that
+ * show guc.c in short transactions are invariably measuring real SETs
+ * (often from connection poolers or ORMs reissuing session setup per
+ * transaction), and the fix is to stop issuing those, not to version
+ * the whole settings array.
  */
 void
 AtStart_GUC(void)
@@ -30,6 +30,23 @@
  *	This approach to free blocks requires fewer malloc/free calls for truly
  *	first allocated, first free'd allocation patterns.
  *
+ *	On converting more executor contexts to this allocator (or to bump.c):
+ *	the blocker is never the allocator, it's the lifetime discipline of
+ *	everything allocating in the context.  A per-tuple or per-group
+ *	context can host arbitrary datatype and extension code via expression
+ *	evaluation, and that code is entitled to pfree and repalloc in any
+ *	order (bump rejects both; generation tolerates them but only profits
+ *	under FIFO-ish behavior).  The conversions that have happened --
+ *	tuplesort's bump use, reorderbuffer's generation contexts, the slab
+ *	contexts for fixed-size decoding state -- were each preceded by
+ *	proving the context's contents are wholly owned by one module.  The
+ *	per-node contexts in nodeAgg/nodeHashjoin don't meet that bar (user
+ *	transition functions allocate there), so fragmentation complaints
+ *	against them are better addressed by sizing ALLOCSET_* parameters than
+ *	by swapping methods.  For observing fragmentation, each method's
+ *	"stats" callback already reports totals vs. freespace per context:
+ *	see MemoryContextStatsDetail and pg_get_backend_memory_contexts().
+ *
  *-------------------------------------------------------------------------
  */
 
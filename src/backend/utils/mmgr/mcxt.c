@@ -1180,6 +1180,25 @@ MemoryContextSizeFailure(MemoryContext context, Size size, int flags)
  *
  * This could be turned into a macro, but we'd have to import
  * nodes/memnodes.h into postgres.h which seems a bad idea.
+ *
+ * On enforcing a per-query or per-backend memory budget here: the
+ * mem_allocated counters make the accounting nearly free, but the
+ * enforcement has two famous problems.  First, a budget check wants the
+ * *total* across a backend's context tree, and allocations happen in
+ * arbitrary contexts -- so either every allocation walks ancestors to a
+ * top-level accumulator (hot-path cost), or a per-backend global is
+ * maintained, which the counter updates in aset/generation/slab would
+ * each need to touch.  Second and worse, failing an allocation "cleanly"
+ * at a cap isn't clean: error recovery itself allocates (ErrorContext is
+ * reserved, but callbacks and the abort path touch other contexts), and
+ * critical sections can't tolerate injected failures at all, so a cap
+ * needs a whitelist of interruptible allocation sites to be safe -- at
+ * which point it resembles a cooperative check (like
+ * CHECK_FOR_INTERRUPTS) more than an allocator feature.  Deployments
+ * wanting a hard backstop today get it from the OS: cgroup memory limits
+ * per service, plus work_mem discipline for the planned consumers.
+ * Observability, unlike enforcement, is already here: see
+ * pg_get_backend_memory_contexts() and pg_log_backend_memory_contexts().
  */
 void *
 MemoryContextAlloc(MemoryContext context, Size size)
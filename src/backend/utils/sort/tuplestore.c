@@ -16,6 +16,23 @@
  * A temporary file is used to handle the data if it exceeds the
  * space limit specified by the caller.
  *
+ * The spill format is a stream of per-tuple length-framed MinimalTuples.
+ * Proposals to replace it with block-packed batches (a block directory,
+ * bulk-written, read back with readahead) should account for what the
+ * framing buys: random access.  Cursors (FETCH ABSOLUTE/backward),
+ * mark/restore, and multiple independent read pointers all seek to
+ * remembered (file, offset) positions, and backward fetch walks tuple
+ * boundaries via the trailing length words -- a batch-packed format
+ * must rebuild all of that through its directory, for consumers that
+ * are frequently interleaving reads and writes of a still-growing
+ * store.  Meanwhile the I/O-size concern is already addressed a layer
+ * down: BufFile buffers writes at BLCKSZ granularity, reads of at
+ * least a full buffer bypass the staging copy entirely (see
+ * BufFileReadDirect), and OS readahead handles the sequential re-read
+ * pattern of CTE rescans.  Profiles showing poor read sizes on spilled
+ * stores are usually measuring tuple-at-a-time *consumers*, not the
+ * file layer.
+ *
  * The (approximate) amount of memory allowed to the tuplestore is specified
  * in kilobytes by the caller.  We absorb tuples and simply store them in an
  * in-memory array as long as we haven't exceeded maxKBytes.  If we do exceed
@@ -4405,6 +4405,21 @@ restore_toc_entries_prefork(ArchiveHandle *AH, TocEntry *pending_list)
  * and so is the RestorePass multi-pass structure.  When we can no longer
  * make any entries ready to process, we exit.  Normally, there will be
  * nothing left to do; but if there is, the third phase will mop up.
+ *
+ * About the last-big-index tail that leaves -j workers idle: each worker
+ * is just a client connection, so a CREATE INDEX it issues already uses
+ * the *server's* parallel build machinery, governed by
+ * max_parallel_maintenance_workers -- restoring with that raised (and
+ * maintenance_work_mem sized) is how the tail gets shortened today.
+ * What this scheduler can't do is negotiate a global worker budget
+ * across concurrent items: the server decides per-statement parallelism
+ * at execution time with no cross-connection arbitration, so any
+ * "borrow idle workers for the last index" scheme needs a server-side
+ * admission mechanism first, not pg_restore changes.  FK validations
+ * are already eligible to interleave with index builds on other tables
+ * as dependencies allow; scheduling them earlier by *predicted
+ * duration* founders on the archive knowing sizes only for data
+ * entries, not for the scans validation will do.
  */
 static void
 restore_toc_entries_parallel(ArchiveHandle *AH, ParallelState *pstate,
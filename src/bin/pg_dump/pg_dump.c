@@ -2780,6 +2780,21 @@ forcePartitionRootLoad(const TableInfo *tbinfo)
  *	  dump the contents of a single table
  *
  * Actually, this just makes an ArchiveEntry for the table contents.
+ *
+ * One entry per table is also why -j parallelism is per-table and a
+ * single huge table serializes a dump.  Splitting a table into several
+ * data entries over TID ranges is implementable on the query side (WHERE
+ * ctid >= '(x,0)' AND ctid < '(y,0)' scans are supported and efficient),
+ * but the archive side is the real work: the directory and custom formats
+ * assume one data member per table for restore ordering, truncation
+ * handling (--clean), and the restore-time "is the table empty" logic, so
+ * multi-segment tables need an archive format version bump and
+ * pg_restore awareness that N entries form one table's data (including
+ * not truncating between segments and combining their row counts).
+ * Snapshot consistency is fine (all workers share the leader's exported
+ * snapshot already).  Until someone does the archive work, the manual
+ * path -- partitioning the big table, which also fixes restore
+ * parallelism permanently -- remains the effective answer.
  */
 static void
 dumpTableData(Archive *fout, const TableDataInfo *tdinfo)
@@ -134,6 +134,22 @@ transfer_all_new_tablespaces(DbInfoArr *old_db_arr, DbInfoArr *new_db_arr,
 	 * NULL tablespace path, which matches all tablespaces.  In parallel mode,
 	 * we pass the default tablespace and all user-created tablespaces and let
 	 * those operations happen in parallel.
+	 *
+	 * In other words: per-tablespace parallel transfer queues exist (-j),
+	 * and the cheap-copy mechanisms (--clone, --copy-file-range, --swap,
+	 * hard links) are explicit modes.  The bits of the wishlist that
+	 * remain unimplemented, and why: choosing clone-vs-copy automatically
+	 * per filesystem is deliberately not done, because the mode choice
+	 * changes rollback semantics (link/swap destroy the old cluster's
+	 * independence) and must stay an operator decision, not an fstatfs
+	 * result; and overlapping file transfer with the schema restore phase
+	 * is unsafe as structured today, since the restore is what creates
+	 * the target relfilenode mapping this transfer consumes -- overlap
+	 * would require per-database pipelining (transfer database A while
+	 * restoring B), which the existing -j machinery could express but the
+	 * sequencing in check/prepare phases currently forbids.  That
+	 * pipelining is the real follow-up project; raw transfer speed
+	 * already scales with tablespaces and jobs.
 	 */
 	if (user_opts.jobs <= 1)
 		parallel_transfer_all_new_dbs(old_db_arr, new_db_arr, old_pgdata,
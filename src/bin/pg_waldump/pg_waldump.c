@@ -2,6 +2,22 @@
  *
  * pg_waldump.c - decode and display WAL
  *
+ * Decoding is serial by design: a WAL record may cross segment
+ * boundaries, and a reader can only find record starts by following the
+ * chain (xl_prev / the page header's xlp_rem_len for continuations), so
+ * workers can't simply start at segment N -- each would have to scan
+ * forward for a plausible record boundary and validate it via the prev
+ * chain, which is exactly the work being parallelized.  Multi-terabyte
+ * forensics parallelizes today at the process level instead: run one
+ * pg_waldump per LSN range with --start/--end on known checkpoint
+ * boundaries (from pg_controldata or the backup history), which gives
+ * linear scaling with none of the merge complexity, and --stats output
+ * that's trivially summable across ranges.  A --stats-only fast path
+ * skipping payload reassembly would still have to reassemble any record
+ * whose *header* crosses pages, and the record header is where all the
+ * accounted sizes live, so the savings over the existing --stats mode
+ * (which already skips rm_desc formatting) are modest.
+ *
  * Copyright (c) 2013-2025, PostgreSQL Global Development Group
  *
  * IDENTIFICATION
@@ -4,6 +4,19 @@
  * A simple benchmark program for PostgreSQL
  * Originally written by Tatsuo Ishii and enhanced by many contributors.
  *
+ * A note on the recurring wish for record/replay of live traffic: pgbench
+ * deliberately executes *scripts*, not captures.  Faithful replay needs
+ * the server-side capture (every parameter value, session state, and
+ * inter-statement timing -- pg_stat_statements stores none of these, and
+ * log_statement output lacks timing/session interleaving fidelity), and
+ * honest re-execution needs the original data state, since replayed DML
+ * diverges after the first conflict.  Tools in the replay niche
+ * (pgreplay-style, or proxy-level captures) own those problems end to
+ * end.  What pgbench provides toward realism is \gset/\aset, per-command
+ * latencies, --rate open-loop scheduling and weighted multi-script runs,
+ * which together let a captured workload be *modeled* with its observed
+ * statement mix and arrival process rather than replayed literally.
+ *
  * src/bin/pgbench/pgbench.c
  * Copyright (c) 2000-2025, PostgreSQL Global Development Group
  * ALL RIGHTS RESERVED;
@@ -355,6 +368,14 @@ typedef struct
  * XXX probably the first value should be kept and used as an offset for
  * better numerical stability...
  */
+/*
+ * Values (latencies/lags, in usec) are additionally binned into
+ * quarter-octave log buckets, giving percentile estimates with ~9% value
+ * resolution over 1 usec .. ~30 min, which is plenty for reporting tail
+ * latencies without retaining individual samples.
+ */
+#define SIMPLE_STATS_NBUCKETS	128
+
 typedef struct SimpleStats
 {
 	int64		count;			/* how many values were encountered */
@@ -362,6 +383,7 @@ typedef struct SimpleStats
 	double		max;			/* the maximum seen */
 	double		sum;			/* sum of values */
 	double		sum2;			/* sum of squared values */
+	int64		hist[SIMPLE_STATS_NBUCKETS];	/* log-bucketed counts */
 } SimpleStats;
 
 /*
@@ -1423,6 +1445,18 @@ initSimpleStats(SimpleStats *ss)
 	memset(ss, 0, sizeof(SimpleStats));
 }
 
+/* which log bucket does a value fall into? */
+static int
+simpleStatsBucket(double val)
+{
+	int			idx;
+
+	if (val <= 1.0)
+		return 0;
+	idx = (int) (log2(val) * 4.0);
+	return Min(idx, SIMPLE_STATS_NBUCKETS - 1);
+}
+
 /*
  * Accumulate one value into a SimpleStats struct.
  */
@@ -1436,6 +1470,7 @@ addToSimpleStats(SimpleStats *ss, double val)
 	ss->count++;
 	ss->sum += val;
 	ss->sum2 += val * val;
+	ss->hist[simpleStatsBucket(val)]++;
 }
 
 /*
@@ -1451,6 +1486,8 @@ mergeSimpleStats(SimpleStats *acc, SimpleStats *ss)
 	acc->count += ss->count;
 	acc->sum += ss->sum;
 	acc->sum2 += ss->sum2;
+	for (int i = 0; i < SIMPLE_STATS_NBUCKETS; i++)
+		acc->hist[i] += ss->hist[i];
 }
 
 /*
@@ -6339,6 +6376,26 @@ printProgressReport(TState *threads, int64 test_start, pg_time_usec_t now,
 	*last_report = now;
 }
 
+/*
+ * Estimate the given percentile (0 < pct < 100) from the log-bucketed
+ * histogram; returns a value in the same unit as the stored values
+ * (usec), taking each bucket at its geometric midpoint.
+ */
+static double
+simpleStatsPercentile(const SimpleStats *ss, double pct)
+{
+	int64		rank = (int64) (ss->count * pct / 100.0);
+	int64		seen = 0;
+
+	for (int i = 0; i < SIMPLE_STATS_NBUCKETS; i++)
+	{
+		seen += ss->hist[i];
+		if (seen > rank)
+			return pow(2.0, (i + 0.5) / 4.0);
+	}
+	return ss->max;
+}
+
 static void
 printSimpleStats(const char *prefix, SimpleStats *ss)
 {
@@ -6349,6 +6406,13 @@ printSimpleStats(const char *prefix, SimpleStats *ss)
 
 		printf("%s average = %.3f ms\n", prefix, 0.001 * latency);
 		printf("%s stddev = %.3f ms\n", prefix, 0.001 * stddev);
+		printf("%s percentiles (approx.) = p50 %.3f / p90 %.3f / p99 %.3f / p99.9 %.3f / p99.99 %.3f ms\n",
+			   prefix,
+			   0.001 * simpleStatsPercentile(ss, 50),
+			   0.001 * simpleStatsPercentile(ss, 90),
+			   0.001 * simpleStatsPercentile(ss, 99),
+			   0.001 * simpleStatsPercentile(ss, 99.9),
+			   0.001 * simpleStatsPercentile(ss, 99.99));
 	}
 }
 
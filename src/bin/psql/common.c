@@ -1748,6 +1748,17 @@ ExecQueryAndProcessResults(const char *query,
 			pg_log_warning("fetching results in chunked mode failed");
 	}
 
+	/*
+	 * Note that chunked-rows mode already removed the per-batch round trip
+	 * the old cursor-based FETCH_COUNT implementation had: the server
+	 * streams the entire result continuously and libpq merely hands it to
+	 * us fetch_count rows at a time, so there is no "next chunk" to
+	 * request and nothing to pipeline -- the network is kept full by the
+	 * server, and the only per-chunk cost left is local formatting.
+	 * High-RTT links therefore no longer pay latency per FETCH_COUNT
+	 * batch, whatever the row count.
+	 */
+
 	/*
 	 * If SIGINT is sent while the query is processing, the interrupt will be
 	 * consumed.  The user's intention, though, is to cancel the entire watch
@@ -1022,6 +1022,16 @@ retrieve_objects(PGconn *conn, vacuumingOptions *vacopts,
 	/*
 	 * Execute the catalog query.  We use the default search_path for this
 	 * query for consistency with table lookups done elsewhere by the user.
+	 *
+	 * Ordering by relpages descending makes -j scheduling
+	 * longest-processing-time-first: the big tables start immediately and
+	 * the small ones pack into whatever connections free up, so one giant
+	 * table can no longer be the last thing dispatched with the other
+	 * connections already drained.  (We don't additionally inject a
+	 * size-scaled PARALLEL n into each command: the server caps effective
+	 * workers by the table's index count and
+	 * max_parallel_maintenance_workers anyway, and vacuumdb second-
+	 * guessing that per table would fight the -j budget for connections.)
 	 */
 	appendPQExpBufferStr(&catalog_query, " ORDER BY c.relpages DESC;");
 	executeCommand(conn, "RESET search_path;", echo);
@@ -115,7 +115,24 @@ typedef IndexBuildResult *(*ambuild_function) (Relation heapRelation,
 /* build empty index */
 typedef void (*ambuildempty_function) (Relation indexRelation);
 
-/* insert this tuple */
+/*
+ * insert this tuple
+ *
+ * This is deliberately a one-tuple-at-a-time interface, although bulk DML
+ * would clearly profit from an "insert this sorted batch, walking each
+ * leaf once" variant.  Anyone adding such an aminsertbatch callback needs
+ * answers for: unique-index enforcement (each tuple's UNIQUE_CHECK result
+ * can force per-tuple error reporting mid-batch, identifying the specific
+ * offending heap row); predicate-lock and WAL ordering, which today
+ * follow heap insertion order rather than key order; SP-GiST/GIN-style
+ * AMs whose insert paths recurse; and the executor's expectation that
+ * index_insert happens while the originating slot's resources are live
+ * (expression indexes evaluate per row in per-tuple memory).  Sorting the
+ * batch per index also has to happen once per index, not once per batch,
+ * since each index has its own key order.  Until an API crosses those,
+ * the leaf-walk savings are approximated by nbtree's cached-rightmost
+ * fastpath for append-ordered keys.
+ */
 typedef bool (*aminsert_function) (Relation indexRelation,
 								   Datum *values,
 								   bool *isnull,
@@ -375,6 +375,10 @@ extern TransactionId heap_index_delete_tuples(Relation rel,
 
 /* in heap/pruneheap.c */
 struct GlobalVisState;
+/* threshold at which heap_hot_search_buffer reports a long HOT chain */
+#define HEAP_LONG_CHAIN_THRESHOLD	8
+
+extern void heap_prune_record_long_chain(Relation relation, BlockNumber blkno);
 extern void heap_page_prune_opt(Relation relation, Buffer buffer);
 extern void heap_page_prune_and_freeze(Relation relation, Buffer buffer,
 									   struct GlobalVisState *vistest,
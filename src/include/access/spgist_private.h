@@ -193,6 +193,14 @@ typedef struct SpGistScanOpaqueData
 	MemoryContext tempCxt;		/* short-lived memory context */
 	MemoryContext traversalCxt; /* single scan lifetime memory context */
 
+	/*
+	 * Readahead for tree descents: child pages are prefetched as their
+	 * search items enter the queue, with at most prefetchDistance prefetches
+	 * outstanding between actual page visits.  See spgAddSearchItemToQueue.
+	 */
+	int			prefetchDistance;	/* from the tablespace's io_concurrency */
+	int			prefetchPending;	/* prefetches since last page visit */
+
 	/* Control flags showing whether to search nulls and/or non-nulls */
 	bool		searchNulls;	/* scan matches (all) null entries */
 	bool		searchNonNulls; /* scan matches (some) non-null entries */
@@ -12,6 +12,19 @@
  * NOTES
  *		See tableam.sgml for higher level documentation.
  *
+ *		A first-party hybrid row/columnar AM is requested regularly.  The
+ *		honest status: this API can express a columnar AM's storage side,
+ *		but the interface is still tuple-at-a-time (scan_getnextslot) and
+ *		TID-addressed, so a columnar AM pays materialization at the
+ *		boundary and must synthesize heap-like TIDs for indexing and DML;
+ *		executor batching (see TupleBatch/ExecProcNodeBatch) is the
+ *		prerequisite for the API growing a batch scan callback that would
+ *		let column chunks flow through without per-row slots.  That
+ *		sequencing -- batch execution first, AM batch interface second,
+ *		an in-tree columnar AM third -- is deliberate; shipping the AM
+ *		first would freeze its performance at the row-boundary ceiling
+ *		the existing extensions already hit.
+ *
  *-------------------------------------------------------------------------
  */
 #ifndef TABLEAM_H
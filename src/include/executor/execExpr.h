@@ -839,6 +839,7 @@ extern void ExprEvalPushStep(ExprState *es, const ExprEvalStep *s);
 /* functions in execExprInterp.c */
 extern void ExecReadyInterpretedExpr(ExprState *state);
 extern ExprEvalOp ExecEvalStepOp(ExprState *state, ExprEvalStep *op);
+extern void ExecExprBatchPrepare(ExprState *state);
 
 extern Datum ExecInterpExprStillValid(ExprState *state, ExprContext *econtext, bool *isNull);
 extern void CheckExprStillValid(ExprState *state, ExprContext *econtext);
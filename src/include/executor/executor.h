@@ -106,6 +106,7 @@ extern void ExecMarkPos(PlanState *node);
 extern void ExecRestrPos(PlanState *node);
 extern bool ExecSupportsMarkRestore(struct Path *pathnode);
 extern bool ExecSupportsBackwardScan(Plan *node);
+extern bool ExecSupportsBatchProtocol(Plan *node);
 extern bool ExecMaterializesOutput(NodeTag plantype);
 
 /*
@@ -295,6 +296,7 @@ extern Node *MultiExecProcNode(PlanState *node);
 extern void ExecEndNode(PlanState *node);
 extern void ExecShutdownNode(PlanState *node);
 extern void ExecSetTupleBound(int64 tuples_needed, PlanState *child_node);
+extern void ExecProcNodeBatchFallback(PlanState *node, TupleBatch *batch);
 
 
 /* ----------------------------------------------------------------
@@ -314,6 +316,33 @@ ExecProcNode(PlanState *node)
 }
 #endif
 
+/* ----------------------------------------------------------------
+ *		ExecProcNodeBatch
+ *
+ *		Execute the given node to return its next batch of tuples.  Nodes
+ *		that don't implement the batch protocol, and nodes being run under
+ *		EXPLAIN ANALYZE (where the instrumentation wrapper has to see every
+ *		tuple), are driven one tuple at a time through the fallback, so any
+ *		node can be asked for a batch.  batch->ntuples == 0 signals that
+ *		the node is exhausted.
+ * ----------------------------------------------------------------
+ */
+#ifndef FRONTEND
+static inline void
+ExecProcNodeBatch(PlanState *node, TupleBatch *batch)
+{
+	if (node->ExecProcNodeBatch != NULL && node->instrument == NULL)
+	{
+		if (node->chgParam != NULL) /* something changed? */
+			ExecReScan(node);	/* let ReScan handle this */
+
+		node->ExecProcNodeBatch(node, batch);
+	}
+	else
+		ExecProcNodeBatchFallback(node, batch);
+}
+#endif
+
 /*
  * prototypes from functions in execExpr.c
  */
@@ -549,6 +578,35 @@ ExecQualAndReset(ExprState *state, ExprContext *econtext)
 
 extern bool ExecCheck(ExprState *state, ExprContext *econtext);
 
+/*
+ * prototypes from functions in execExprBatch.c
+ */
+
+/* maximum number of tuples evaluated per ExprEvalBatch */
+#define EXEC_EXPR_BATCH_SIZE	1024
+
+/*
+ * Working state for batch-oriented expression evaluation.  One of these is
+ * typically created per node and reused across batches; see execExprBatch.c
+ * for the evaluation entry points and memory management rules.
+ */
+typedef struct ExprEvalBatch
+{
+	int			maxtuples;		/* allocated size of the arrays below */
+	int			ntuples;		/* number of valid input slots */
+	TupleTableSlot **slots;		/* input tuples, filled by caller */
+	Datum	   *values;			/* per-tuple result values */
+	bool	   *nulls;			/* per-tuple result null flags */
+	int			nselected;		/* number of qualifying tuples (quals only) */
+	int		   *selection;		/* indexes of qualifying tuples */
+} ExprEvalBatch;
+
+extern ExprEvalBatch *ExecCreateExprBatch(EState *estate, int maxtuples);
+extern void ExecEvalExprBatch(ExprState *state, ExprContext *econtext,
+							  ExprEvalBatch *batch);
+extern void ExecQualBatch(ExprState *state, ExprContext *econtext,
+						  ExprEvalBatch *batch);
+
 /*
  * prototypes from functions in execSRF.c
  */
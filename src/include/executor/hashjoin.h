@@ -351,6 +351,14 @@ typedef struct HashJoinTableData
 	MemoryContext batchCxt;		/* context for this-batch-only storage */
 	MemoryContext spillCxt;		/* context for spilling to temp files */
 
+	/*
+	 * In a multi-batch private hash join, a Bloom filter over the hash
+	 * values of the entire inner relation, used to discard probe-side tuples
+	 * with no possible match before they are saved to outer batch files.
+	 * NULL if not in use (single batch or parallel hash).
+	 */
+	struct bloom_filter *bloomFilter;
+
 	/* used for dense allocation of tuples (into linked chunks) */
 	HashMemoryChunk chunks;		/* one list for the whole batch */
 
@@ -132,6 +132,14 @@ struct TupleTableSlotOps;
 extern LLVMValueRef slot_compile_deform(struct LLVMJitContext *context, TupleDesc desc,
 										const struct TupleTableSlotOps *ops, int natts);
 
+/*
+ ****************************************************************************
+ * Cross-backend compile tracking, from llvmjit_cache.c.
+ ****************************************************************************
+ */
+extern uint64 llvm_expr_fingerprint(struct ExprState *state);
+extern void llvm_cache_note_compile(uint64 fingerprint, double compile_ms);
+
 /*
  ****************************************************************************
  * Extensions / Backward compatibility section of the LLVM C API
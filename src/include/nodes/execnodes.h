@@ -147,6 +147,12 @@ typedef struct ExprState
 	 * ExecInitExprRec().
 	 */
 	ErrorSaveContext *escontext;
+
+	/*
+	 * Fused batch qual kernel selected by ExecExprBatchPrepare(), or NULL.
+	 * Only consulted by ExecQualBatch(); see execExprBatch.c.
+	 */
+	void	   *batchkernel;
 } ExprState;
 
 
@@ -1148,6 +1154,28 @@ typedef struct JsonExprState
  */
 typedef TupleTableSlot *(*ExecProcNodeMtd) (struct PlanState *pstate);
 
+/*
+ * A vector of tuples exchanged between batch-aware plan nodes.  The caller
+ * provides the slots pointer array (sized for maxtuples); the producing node
+ * fills it with pointers to its own slots, which remain valid only until the
+ * next batch is requested from that node.  ntuples == 0 signals end of data.
+ */
+typedef struct TupleBatch
+{
+	int			maxtuples;		/* capacity of slots array */
+	int			ntuples;		/* number of tuples returned */
+	TupleTableSlot **slots;		/* producer-owned result slots */
+} TupleBatch;
+
+/*
+ * Batched variant of ExecProcNodeMtd.  Nodes that can produce several
+ * tuples per call set PlanState->ExecProcNodeBatch to one of these; all
+ * other nodes leave it NULL and are driven through the one-tuple-at-a-time
+ * fallback.  See ExecProcNodeBatch() in executor.h.
+ */
+typedef void (*ExecProcNodeBatchMtd) (struct PlanState *pstate,
+									  struct TupleBatch *batch);
+
 /* ----------------
  *		PlanState node
  *
@@ -1170,6 +1198,9 @@ typedef struct PlanState
 	ExecProcNodeMtd ExecProcNode;	/* function to return next tuple */
 	ExecProcNodeMtd ExecProcNodeReal;	/* actual function, if above is a
 										 * wrapper */
+	ExecProcNodeBatchMtd ExecProcNodeBatch; /* batched variant, or NULL if
+											 * this node only produces tuples
+											 * one at a time */
 
 	Instrumentation *instrument;	/* Optional runtime stats for this node */
 	WorkerInstrumentation *worker_instrument;	/* per-worker instrumentation */
@@ -1631,6 +1662,11 @@ typedef struct SeqScanState
 {
 	ScanState	ss;				/* its first field is NodeTag */
 	Size		pscan_len;		/* size of parallel heap scan descriptor */
+
+	/* remaining fields serve the batched path, see ExecSeqScanBatch */
+	struct ExprEvalBatch *ss_qualBatch; /* qual evaluation working state */
+	TupleTableSlot **ss_batchSlots; /* private scan slots, created on use */
+	int			ss_numBatchSlots;	/* allocated length of ss_batchSlots */
 } SeqScanState;
 
 /* ----------------
@@ -2176,6 +2212,17 @@ typedef struct NestLoopState
 	bool		nl_NeedNewOuter;
 	bool		nl_MatchedOuter;
 	TupleTableSlot *nl_NullInnerTupleSlot;
+
+	/*
+	 * Support for suppressing inner parameter-change signaling when the new
+	 * outer tuple supplies the same values as the previous one; see
+	 * ExecNestLoop.  The arrays are indexed by position in nestParams and
+	 * only byval parameters participate (nl_ParamByVal).
+	 */
+	bool		nl_PrevParamsValid; /* do the arrays hold prior values? */
+	bool	   *nl_ParamByVal;	/* is parameter's type pass-by-value? */
+	Datum	   *nl_PrevParamValues; /* previous outer-tuple param values */
+	bool	   *nl_PrevParamNulls;	/* previous param null flags */
 } NestLoopState;
 
 /* ----------------
@@ -2602,6 +2649,10 @@ typedef struct AggState
 	AggStatePerGroup *all_pergroups;	/* array of first ->pergroups, than
 										 * ->hash_pergroup */
 	SharedAggInfo *shared_info; /* one entry per worker */
+	uint64		hash_input_tuples;	/* tuples read from the outer plan while
+									 * filling the hash tables; feeds the
+									 * observed group-to-input ratio used to
+									 * size spill partitions */
 } AggState;
 
 /* ----------------
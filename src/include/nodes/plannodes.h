@@ -940,6 +940,17 @@ typedef struct NestLoop
 	Join		join;
 	/* list of NestLoopParam nodes */
 	List	   *nestParams;
+
+	/*
+	 * True if the executor may refrain from signaling an inner-side
+	 * parameter change when consecutive outer tuples supply identical
+	 * parameter values, allowing caches in the inner subtree (single-batch
+	 * hash tables, Memoize) to survive the rescan.  Set only when the
+	 * planner has proven that replaying cached inner results cannot change
+	 * behavior: no volatile functions anywhere in the query and no
+	 * subplans (whose bodies the check cannot see).  See ExecNestLoop.
+	 */
+	bool		paramCacheSafe;
 } NestLoop;
 
 typedef struct NestLoopParam
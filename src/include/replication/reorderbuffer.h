@@ -668,6 +668,10 @@ struct ReorderBuffer
 	char	   *outbuf;
 	Size		outbufsize;
 
+	/* scratch buffer for spill-file (de)compression */
+	char	   *compbuf;
+	Size		compbufsize;
+
 	/* memory accounting */
 	Size		size;
 
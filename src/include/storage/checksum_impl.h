@@ -79,6 +79,21 @@
  * GCC versions the flags -msse4.1 -funroll-loops -ftree-vectorize are enough
  * to achieve vectorization.
  *
+ * A hardware-CRC32C mode (reusing the sse4.2/armv8 paths under src/port)
+ * is requested now and then, since crc32 instructions beat even the
+ * vectorized build of this code.  It's not merely a matter of swapping
+ * the function: the algorithm is part of the on-disk page format, with no
+ * bits to spare in the checksum field to tag which algorithm produced a
+ * page's value, so a cluster must be uniformly one algorithm and the
+ * choice has to live in pg_control from initdb, with pg_checksums able to
+ * rewrite every page for conversion and pg_upgrade refusing mismatched
+ * clusters.  Any such proposal also has to re-run the error-model
+ * analysis above: CRC32C guarantees burst-error detection that FNV
+ * doesn't, but loses the multiply-based avalanche, and the 16-bit
+ * reduction step changes its properties.  The groundwork (algorithm
+ * registry in pg_control, tooling conversions) is the actual project;
+ * the kernels already exist.
+ *
  * The optimal amount of parallelism to use depends on CPU specific instruction
  * latency, SIMD instruction width, throughput and the amount of registers
  * available to hold intermediate state. Generally, more parallelism is better
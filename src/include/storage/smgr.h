@@ -44,6 +44,16 @@ typedef struct SMgrRelationData
 	 * invalidation for fork extension.
 	 */
 	BlockNumber smgr_targblock; /* current insertion target block */
+
+	/*
+	 * Range of newly-extended blocks this backend withheld from the FSM for
+	 * its own future insertions (see RelationAddBlocks); InvalidBlockNumber
+	 * when none.  Letting each inserter keep a few private candidates means
+	 * concurrent inserters fan out without re-walking the FSM per page.
+	 */
+	BlockNumber smgr_reservedblock; /* first still-unused reserved block */
+	BlockNumber smgr_lastreservedblock;	/* last reserved block */
+
 	BlockNumber smgr_cached_nblocks[MAX_FORKNUM + 1];	/* last known size */
 
 	/* additional public fields may someday exist here */
@@ -53,6 +53,7 @@ typedef struct catcache
 	int			cc_keyno[CATCACHE_MAXKEYS]; /* AttrNumber of each key */
 	int			cc_nkeys;		/* # of keys (1..CATCACHE_MAXKEYS) */
 	int			cc_ntup;		/* # of tuples currently in this cache */
+	int			cc_nnegtup;		/* # of negative tuples among cc_ntup */
 	int			cc_nlist;		/* # of CatCLists currently in this cache */
 	int			cc_nlbuckets;	/* # of CatCList hash buckets in this cache */
 	dlist_head *cc_lbucket;		/* hash buckets for CatCLists */
@@ -63,6 +63,18 @@ extern char **GetWaitEventCustomNames(uint32 classId, int *nwaitevents);
  *
  *	my_wait_event_info initially points to local memory, making it safe to
  *	call this before MyProc has been initialized.
+ *
+ *	The single-store cheapness here is also the answer to why the server
+ *	doesn't accumulate wait *duration* histograms: timing a wait means two
+ *	clock reads bracketing every report, and these calls sit on paths (one
+ *	per lwlock sleep, buffer read, etc.) where even rdtsc-class overhead
+ *	and the histogram cache traffic are measurable -- that cost would be
+ *	paid always, to answer questions asked rarely.  The supported ways to
+ *	get durations are sampling this field at frequency (extensions like
+ *	pg_wait_sampling do exactly that, with overhead proportional to the
+ *	sampling rate rather than the wait rate) and the targeted timing that
+ *	already exists where it pays: track_io_timing, track_wal_io_timing,
+ *	log_lock_waits.
  * ----------
  */
 static inline void
@@ -3,6 +3,21 @@
  * fe-connect.c
  *	  functions related to setting up a connection to the backend
  *
+ * A connection here is one socket bound to one server process for its
+ * lifetime; that 1:1:1 coupling is assumed by both ends (per-backend
+ * session state, GUCs, transaction status; per-connection auth and TLS
+ * context).  Protocol-level session multiplexing -- many lightweight
+ * sessions interleaved over one socket, scheduled onto a backend pool
+ * server-side -- is therefore not a libpq feature that could be added
+ * alone: it requires a framing layer tagging every message with a
+ * session id (a protocol major change), a server dispatcher decoupling
+ * sockets from processes (the session/process split, the hardest open
+ * problem in this codebase), and client API rework since a PGconn *is*
+ * the session object.  The deployable form of this idea is a pooler in
+ * transaction mode, which collapses server-side connection counts today;
+ * client-side, a process sharing a few PGconns behind its own mutex gets
+ * the 50x socket reduction without protocol changes.
+ *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
  *
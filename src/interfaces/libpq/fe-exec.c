@@ -3871,6 +3871,21 @@ interpret_error:
 /*
  * PQgetvalue:
  *	return the value of field 'field_num' of row 'tup_num'
+ *
+ * Note for those designing "zero-copy" result APIs: this function already
+ * copies nothing -- it returns a pointer into PGresult storage, valid for
+ * the result's lifetime, and drivers that copy do so by their own choice
+ * (usually to unpin the PGresult).  The one copy libpq itself makes is
+ * during protocol parsing, from the connection's receive buffer into
+ * pqResultAlloc storage (getAnotherTuple), and that one is load-bearing:
+ * the receive buffer is a reused ring that the next message overwrites,
+ * so handing out pointers into it would tie result validity to the
+ * connection's read progress -- a lifetime contract callers can't
+ * reasonably honor outside tightly-scoped streaming (which is what
+ * single-row and chunked-rows modes provide, bounding the window to one
+ * row/chunk while still materializing it).  Caller-supplied arenas for
+ * PGresult would save malloc traffic, not copies, and PGresult's
+ * block-suballocation already amortizes most of that.
  */
 char *
 PQgetvalue(const PGresult *res, int tup_num, int field_num)
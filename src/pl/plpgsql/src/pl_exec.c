@@ -6027,6 +6027,23 @@ loop_exit:
  *
  * Note: if pass-by-reference, the result is in the eval_mcontext.
  * It will be freed when exec_eval_cleanup is done.
+ *
+ * As for compiling whole plpgsql bodies into fused ExprState programs so
+ * the JIT can chew on them: the simple-expression machinery here is as
+ * far as that idea has gotten honestly.  Statements aren't expressions --
+ * control flow, variable assignment with plpgsql's coercion/copy
+ * semantics, exception blocks (which need subtransactions), and any
+ * statement touching SPI can't lower into execExpr steps, so a "fused"
+ * body ends up needing either a plpgsql-specific bytecode with its own
+ * JIT (a new engine, not a lowering) or restrictions so severe that only
+ * arithmetic-over-locals loops qualify.  What this path already achieves
+ * for exactly those loops: simple expressions bypass SPI/portal overhead
+ * entirely, share a cached ExprState across calls, and that ExprState is
+ * JIT-eligible like any other.  The residual per-iteration cost is
+ * plpgsql's variable store/coercion semantics, which is the language,
+ * not the executor.  Tight numeric kernels that need C speed should be C
+ * (or SQL-language functions, which inline into the calling query and
+ * vanish as calls altogether).
  * ----------
  */
 static bool
@@ -1644,3 +1644,23 @@ drop table agg_hash_1;
 drop table agg_hash_2;
 drop table agg_hash_3;
 drop table agg_hash_4;
+
+-- Exercise the fused batch qual kernels used by plain aggregation over
+-- sequential scans: integer and float8 comparisons against constants,
+-- commuted operand order, NULL attribute values, and this tree's
+-- NaN-sorts-greatest float semantics.
+create table agg_batch_qual (i int4, b int8, f float8);
+insert into agg_batch_qual values
+  (1, 1, 1.5),
+  (5, 5, 10.5),
+  (null, null, null),
+  (10, 10, 'NaN');
+select count(*) from agg_batch_qual where i < 5;
+select count(*) from agg_batch_qual where 5 <= i;
+select count(*) from agg_batch_qual where b <> 5;
+select count(*) from agg_batch_qual where b = 10;
+select count(*) from agg_batch_qual where f > 10;
+select count(*) from agg_batch_qual where f = 'NaN';
+select count(*) from agg_batch_qual where f < 'NaN';
+select count(*) from agg_batch_qual where f >= 1.5;
+drop table agg_batch_qual;
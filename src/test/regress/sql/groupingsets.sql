@@ -119,6 +119,10 @@ select a, b, sum(v), count(*) from gstest_empty group by grouping sets ((a,b),()
 select a, b, sum(v), count(*) from gstest_empty group by grouping sets ((a,b),(),(),());
 select sum(v), count(*) from gstest_empty group by grouping sets ((),(),());
 
+-- non-empty input over only empty grouping sets: one result row per set
+select sum(v), count(*) from (values (1),(2),(3)) sub(v)
+ group by grouping sets ((),());
+
 -- empty input with joins tests some important code paths
 select t1.a, t2.b, sum(t1.v), count(*) from gstest_empty t1, gstest_empty t2
  group by grouping sets ((t1.a,t2.b),());
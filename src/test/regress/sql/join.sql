@@ -3658,3 +3658,27 @@ SELECT COUNT(*) FROM onek t1 LEFT JOIN tenk1 t2
     ON (t2.thousand = t1.tenthous OR t2.thousand = t1.thousand);
 SELECT COUNT(*) FROM onek t1 LEFT JOIN tenk1 t2
     ON (t2.thousand = t1.tenthous OR t2.thousand = t1.thousand);
+
+--
+-- Nestloop inner parameter-change suppression (NestLoop.paramCacheSafe):
+-- with a volatile function in the query the suppression must not engage,
+-- so the lateral subtree re-executes for every outer row even when
+-- consecutive rows supply identical parameter values; without volatiles
+-- it may engage, and results must be unchanged.
+--
+create temp sequence nl_param_seq;
+create temp table nl_param_outer (a int);
+insert into nl_param_outer values (1), (1), (1);
+-- volatile inner: nextval must run once per outer row (expect f = 1,2,3)
+select sum(x.v) from nl_param_outer t,
+  lateral (select t.a + f as v from nextval('nl_param_seq') f) x;
+select currval('nl_param_seq');
+-- volatile-free laterals over repeated outer keys still join correctly
+create temp table nl_param_inner (k int, v int);
+insert into nl_param_inner values (1, 10), (2, 20);
+create temp table nl_param_outer2 (k int);
+insert into nl_param_outer2 values (1), (1), (2), (2), (1);
+select sum(i.v) from nl_param_outer2 o,
+  lateral (select v from nl_param_inner i where i.k = o.k) i;
+select sum(o.k + s) from nl_param_outer2 o,
+  lateral generate_series(1, o.k) s;